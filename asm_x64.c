@@ -3,6 +3,14 @@
  * Dual Licenced under MIT and Public Domain.
  *
  * This file includes all of the source for the "chasm" library macros and functions.
+ *
+ * Options, defined before compiling this file:
+ *   ASM_X64_MALLOC, ASM_X64_CALLOC, ASM_X64_REALLOC, ASM_X64_FREE:
+ *     Names for user-provided malloc(), calloc(), realloc() and free() functions. Code and stencils returned are
+ *     allocated with these, so free them with ASM_X64_FREE.
+ *   ASM_X64_NO_DUAL_MAP:
+ *     On Linux, x64exec() maps code twice from a memfd, once executable and once writable, so it's never both. This makes it
+ *     map code once and briefly make it writable and executable to copy to and patch it, like every other platform.
  */
 
 #include <stdint.h>
@@ -10,6 +18,27 @@
 #include <string.h>
 #include <stdarg.h>
 #include <malloc.h>
+
+#ifndef ASM_X64_MALLOC
+#define ASM_X64_MALLOC malloc
+#endif
+
+#ifndef ASM_X64_CALLOC
+#define ASM_X64_CALLOC calloc
+#endif
+
+#ifndef ASM_X64_REALLOC
+#define ASM_X64_REALLOC realloc
+#endif
+
+#ifndef ASM_X64_FREE
+#define ASM_X64_FREE free
+#endif
+
+// Before asm_x64.h, since its register macros (cs, ss, di...) collide with names used in the intrinsics headers.
+#if defined __AVX2__ || defined __SSE2__
+#include <immintrin.h>
+#endif
 #include "asm_x64.h"
 
 
@@ -43,7 +72,7 @@ struct x64LookupGeneralIns {
 		bool modrmreq;
 		bool modrmreg;
 		bool preffered;
-		// uint8_t base_size;
+		uint8_t enc; // Index of the form's encoder in x64Encoders, set at load time.
 		uint8_t arglen;
 		uint32_t opcode;
 		uint32_t prefixes;
@@ -8943,7 +8972,7 @@ static const x64LookupGeneralIns x64Table[] = {
 		.opcode = 0xC10F, .oplen = 2,
 	} } },
 	{ "xbegin", 1, (struct x64LookupActualIns[]) { {
-		.args = { REL32 }, .arglen = 1,
+		.args = { REL32 }, .arglen = 1, .rel_oper = 1,
 		.opcode = 0xF8C7, .oplen = 2,
 	} } },
 	{ "xchg", 16, (struct x64LookupActualIns[]) { {
@@ -9221,7 +9250,7 @@ static const x64LookupGeneralIns x64Table[] = {
 
 // https://l-m.dev/cs/jitcalc/#:~:text=make%20it%20executable%3F-,C%20Territory,-V%20does%20not
 
-static u32 encode(const x64Ins* ins, x64LookupActualIns* res, u8* opcode_dest);
+static u32 encode(const x64Ins* ins, const x64LookupActualIns* res, u8* opcode_dest);
 
 #define ismem(x) (x & X64_ALLMEMMASK)
 #define membase(x)  ((x >> 32) & 0x1f)
@@ -9253,6 +9282,129 @@ char* x64error(x64ErrorType* errcode) {
   return NULL;
 }
 
+// ---------------------------- Operand dispatch table ---------------------------- //
+
+// Ops with more forms than this (MOV, ADD, CMP...) get a dispatch table instead of a linear scan over their forms.
+#define X64_DISPATCH_MIN_FORMS 8
+
+// Stands in for "no operand" at positions past an instruction's last operand. Never used by x64OperandType.
+#define X64_NOOPERAND ((u64) 1 << 63)
+
+// Every operand type bit maps to the bitset of forms accepting it at each position, so an operand's matching forms are
+// the OR of the bitsets of its type bits (usually 1 or 2 of them), and the instruction's are those ANDed together.
+struct x64Dispatch {
+  u64 classes[4];   // Type bits accepted at each position by any form, X64_NOOPERAND if a form ends before it.
+  u64 preferred;    // Bitset of the forms with `preffered` set.
+  u64 forms[4][64]; // Bitset of the forms accepting each type bit at each position.
+};
+static struct x64Dispatch* x64DispatchTable;
+static u8 x64DispatchIdx[sizeof(x64Table) / sizeof(x64LookupGeneralIns)]; // Index + 1 into x64DispatchTable, 0 if none.
+
+// Structure-of-arrays copy of the operand masks of every other op, so matching an instruction against all of its forms
+// only pulls in the masks and not the encoding fields around them. An op's forms are laid out as 4 arrays of `stride`
+// masks, one per operand position, padded with 0s to a multiple of 2 forms for SSE. Operand counts are matched up front
+// through `arity` instead, so only the positions the instruction actually uses get tested.
+static struct x64MatchView {
+  u32 first;    // Index of the op's first mask in x64MatchArgs.
+  u8 stride;    // Number of forms, padded.
+  u8 preferred; // Bitset of the forms with `preffered` set.
+  u8 arity[5];  // Bitset of the forms taking each number of operands.
+} x64MatchIdx[sizeof(x64Table) / sizeof(x64LookupGeneralIns)];
+static u64* x64MatchArgs;
+
+// Generates the dispatch tables and match view from x64Table once at load time. 22 ops as of writing get a dispatch
+// table, so ~45kb, and the match view takes ~75kb.
+__attribute__((constructor)) static void lookup_init(void) {
+  u32 num = 0, masks = 0;
+  for(u32 i = 0; i < sizeof(x64Table) / sizeof(x64LookupGeneralIns); i ++) {
+    if(x64Table[i].numactualins > X64_DISPATCH_MIN_FORMS) x64DispatchIdx[i] = ++ num;
+    else {
+      x64MatchIdx[i].first = masks;
+      x64MatchIdx[i].stride = (x64Table[i].numactualins + 1) & ~1;
+      masks += x64MatchIdx[i].stride * 4;
+    }
+  }
+
+  x64DispatchTable = ASM_X64_CALLOC(num, sizeof(struct x64Dispatch));
+  x64MatchArgs = ASM_X64_CALLOC(masks, sizeof(u64));
+
+  for(u32 i = 0; i < sizeof(x64Table) / sizeof(x64LookupGeneralIns); i ++) {
+    if(!x64DispatchIdx[i]) {
+      struct x64MatchView* v = x64MatchIdx + i;
+      for(u32 f = 0; f < x64Table[i].numactualins; f ++) {
+        const x64LookupActualIns* form = x64Table[i].ins + f;
+        if(form->preffered) v->preferred |= 1 << f;
+        v->arity[form->arglen] |= 1 << f;
+        for(u32 j = 0; j < form->arglen; j ++)
+          x64MatchArgs[v->first + j * v->stride + f] = form->args[j];
+      }
+      continue;
+    }
+
+    struct x64Dispatch* d = x64DispatchTable + x64DispatchIdx[i] - 1;
+    for(u32 f = 0; f < x64Table[i].numactualins; f ++) {
+      const x64LookupActualIns* form = x64Table[i].ins + f;
+      if(form->preffered) d->preferred |= (u64) 1 << f;
+
+      for(u32 j = 0; j < 4; j ++) {
+        u64 bits = form->arglen > j ? form->args[j] : X64_NOOPERAND;
+        d->classes[j] |= bits;
+        for(; bits; bits &= bits - 1)
+          d->forms[j][__builtin_ctzll(bits)] |= (u64) 1 << f;
+      }
+    }
+  }
+}
+
+// Bitset of the forms of `d` that accept an operand of type `type` at position `pos`.
+static inline u64 dispatch_forms(const struct x64Dispatch* d, u32 pos, u64 type) {
+  u64 forms = 0;
+  for(u64 bits = type & d->classes[pos]; bits; bits &= bits - 1)
+    forms |= d->forms[pos][__builtin_ctzll(bits)];
+  return forms;
+}
+
+// Bitset of the forms in the match view `v` taking `num` operands whose masks intersect all of their types, tested a
+// vector of forms at a time and without branching on any of them.
+static inline u64 match_forms(const struct x64MatchView* v, const u64 types[4], u32 num) {
+  const u64* args = x64MatchArgs + v->first;
+  u64 forms = 0;
+  u32 f = 0;
+
+#if defined __AVX2__
+  for(; f + 4 <= v->stride; f += 4) {
+    __m256i nomatch = _mm256_setzero_si256();
+    for(u32 j = 0; j < num; j ++) {
+      __m256i masks = _mm256_loadu_si256((const __m256i*) (args + j * v->stride + f));
+      nomatch = _mm256_or_si256(nomatch, _mm256_cmpeq_epi64(_mm256_and_si256(masks, _mm256_set1_epi64x(types[j])), _mm256_setzero_si256()));
+    }
+    forms |= (u64) (~_mm256_movemask_pd(_mm256_castsi256_pd(nomatch)) & 0xf) << f;
+  }
+#endif
+#if defined __SSE2__
+  for(; f < v->stride; f += 2) {
+    __m128i nomatch = _mm_setzero_si128();
+    for(u32 j = 0; j < num; j ++) {
+      __m128i masks = _mm_loadu_si128((const __m128i*) (args + j * v->stride + f));
+
+      // SSE2 has no 64 bit compare, so a 64 bit lane is zero if both of its 32 bit halves are.
+      __m128i zero = _mm_cmpeq_epi32(_mm_and_si128(masks, _mm_set1_epi64x(types[j])), _mm_setzero_si128());
+      nomatch = _mm_or_si128(nomatch, _mm_and_si128(zero, _mm_shuffle_epi32(zero, _MM_SHUFFLE(2, 3, 0, 1))));
+    }
+    forms |= (u64) (~_mm_movemask_pd(_mm_castsi128_pd(nomatch)) & 0x3) << f;
+  }
+#else
+  for(; f < v->stride; f ++) {
+    bool match = true;
+    for(u32 j = 0; j < num; j ++)
+      match &= (args[j * v->stride + f] & types[j]) != 0;
+    forms |= (u64) match << f;
+  }
+#endif
+
+  return forms & v->arity[num];
+}
+
 static inline x64LookupActualIns* identify(const x64Ins* ins) {
   if (ins->op > sizeof(x64Table) / sizeof(x64LookupGeneralIns) || ins->op < 1) {
     error(ASMERR_INVALID_INS, "Invalid instruction: %d.", ins->op);
@@ -9260,13 +9412,11 @@ static inline x64LookupActualIns* identify(const x64Ins* ins) {
   }
 
   const x64LookupGeneralIns* unresins = x64Table + (ins->op - 1);
-  x64LookupActualIns* resolved = NULL;
-  bool preferred = false;
 
   u64 insoperands[] = { ins->params[0].type, ins->params[1].type, ins->params[2].type, ins->params[3].type };
 
   u32 operandnum = 0;
-  while(insoperands[operandnum] && operandnum < 4)
+  while(operandnum < 4 && insoperands[operandnum])
     operandnum ++;
 
   // Specifies bigger, more specific sizes for MOV based on the immediate value. Basically, picks the right instruction when there's an ambiguous immediate value.
@@ -9292,72 +9442,58 @@ next:
   
   // ---------------------- Instruction resolution and Validation ---------------------- //
 
-  for(u32 i = 0; i < unresins->numactualins; i ++) {
-    if(unresins->ins[i].arglen != operandnum) continue;
-    x64LookupActualIns* currentins = unresins->ins + i;
+  u64 forms, preferred;
+  if(x64DispatchIdx[ins->op - 1]) {
+    for(u32 j = 0; j < 4; j ++)
+      insoperands[j] = j < operandnum ? insoperands[j] & ~X64_NOOPERAND : X64_NOOPERAND;
 
-    // bool morespecific = false;
-    for(u32 j = 0; j < operandnum; j ++) {
-      if(!(currentins->args[j] & insoperands[j])) goto cont;
-      // else if(resolved && (
-          // resolved->args[j] < (currentins->args[j] & insoperands[j]) || // Generally, more specific arguments have a higher set bit than less specific ones.
-          // (resolved->modrmreq && !currentins->modrmreq))) morespecific = true;
-    }
-    
-    if(preferred && !currentins->preffered) continue;
-    else if(currentins->preffered) preferred = true; // this order is necessary, since the first if validates there's no preference, and the last if only works if there's no preference
-    else if(resolved) continue;
-    resolved = currentins;
-cont:
-    continue;
+    const struct x64Dispatch* d = x64DispatchTable + x64DispatchIdx[ins->op - 1] - 1;
+    forms = dispatch_forms(d, 0, insoperands[0]) & dispatch_forms(d, 1, insoperands[1]) &
+            dispatch_forms(d, 2, insoperands[2]) & dispatch_forms(d, 3, insoperands[3]);
+    preferred = forms & d->preferred;
+  } else {
+    forms = match_forms(x64MatchIdx + ins->op - 1, insoperands, operandnum);
+    preferred = forms & x64MatchIdx[ins->op - 1].preferred;
   }
 
-  if(!resolved) {
+  if(!forms) {
     error(ASMERR_INS_ARGUMENT_MISMATCH, "Argument mismatch for %s.", x64stringify(ins, 1));
     return NULL;
   }
 
-  return resolved;
+  // When several forms match, the last preferred one wins, otherwise the first one.
+  return unresins->ins + (preferred ? 63 - __builtin_clzll(preferred) : __builtin_ctzll(forms));
 }
 
-// static inline u32 ins_size(x64LookupActualIns* res, x64Ins* ins) {
-//   bool rex = res->rex || (res->reg_oper && ins->params[res->reg_oper - 1].value & 0x8);
-//   int modrm = res->modrmreq;
-//   if(modrm) {
-//     x64Operand* rm = ins->params + res->mem_oper - 1;
-    
-//     if(ismem(rm->type)) {
-//       if(rm->value & 0x2000000000000000) modrm = 5;
-//       else if(membase(rm->value) & 0x10) modrm = 6; // THIS IS WRONG, IT CAN HAVE SIZE 2 BASED ON HAVING A DISPLACEMENT OR NOT
-//       else {
-//         if((membase(rm->value) | memindex(rm->value)) & 0x8) rex = true;
-//         if (rm->value) {
-//           modrm += ((i32) rm->value > 127 || (i32) rm->value < -128) * 3 + 1;
-//           if(memindex(rm->value) != 0x10) modrm += 1;
-//         }
-//       }
-//     }
-//   }
-//   return rex + modrm + res->base_size;
-// }
+// ------------------------------ Specialized encoders ------------------------------ //
 
-// Instructions to keep note of: MOVS mem, mem on line 1203, page 844 in the manual.
-static u32 encode(const x64Ins* ins, x64LookupActualIns* res, u8* opcode_dest) {
-  if(!res) return 0;
+// Encoding classes, which decide which parts of the instruction encode_form has to emit. Every form's `enc` indexes
+// the encoder for its class in x64Encoders. Classes are numbered `vex * 24 + layout * 8 + trailer`.
+enum x64EncLayout { X64_ENC_NOMODRM, X64_ENC_OPREG /* +rb, +rw, +rd... */, X64_ENC_MODRM };
+enum x64EncTrailer { X64_ENC_NONE, X64_ENC_IMM8, X64_ENC_IMM16, X64_ENC_IMM32, X64_ENC_IMM64, X64_ENC_REL8, X64_ENC_REL32, X64_ENC_IS4 };
+#define X64_ENC_CLASS(vex, layout, trailer) ((vex) * 24 + (layout) * 8 + (trailer))
+#define X64_ENC_GENERIC 48 // For any class without an encoder of its own, decided at runtime from the form.
+#define X64_ENC_ENTER   49
 
-  // ------------------------------ Special Instructions ------------------------------ //
+// Instructions to keep note of: MOVS mem, mem on line 1203, page 844 in the manual.
+// Always inlined with constant `vex`, `layout` and `trailer` into one encoder per class, so each of them only keeps the
+// branches that depend on the operands themselves.
+static inline __attribute__((always_inline)) u32 encode_form(const x64Ins* ins, const x64LookupActualIns* res, u8* opcode_dest,
+                                                              const bool vex, const u8 layout, const u8 trailer) {
+  u8 *const opcode_dest_start = opcode_dest;
 
-  // Enter is the weirdest instruction ever :'(
-  if(ins->op == ENTER) {
-    *(u32*) opcode_dest = (u32) 0xC8 | (u32) ((u16) ins->params[0].value) << 8 | (u32) ((u8) ins->params[1].value) << 24;
-    return 4;
+  if(res->mem_oper) {
+    
+    // Segment Register for memory operands - Prefix group 2 (GCC Ordering)
+    if(ins->params[res->mem_oper - 1].value & ((u64) 0x7 << 56))
+      *opcode_dest = ((u8[]) { 0x26, 0x2e, 0x36, 0x3e, 0x64, 0x65 })[((ins->params[res->mem_oper - 1].value >> 56) & 0x7) - 1], opcode_dest ++;
+  
+    // 67H prefix - Prefix group 4 (GCC Ordering)
+    if(ins->params[res->mem_oper - 1].value & ((u64) 0x1 << 60))
+      *opcode_dest = 0x67, opcode_dest ++;
   }
 
-  // ----------------------------- Instruction encoding ----------------------------- //
-
-  u8 *const opcode_dest_start = opcode_dest;
-
-  if(res->vex) {
+  if(vex) {
     u8 vex_map = res->vex & 0xf;
     
     u8 vex_byte = res->vex_byte;
@@ -9392,19 +9528,8 @@ static u32 encode(const x64Ins* ins, x64LookupActualIns* res, u8* opcode_dest) {
     }
   }
   
-  if(res->mem_oper) {
-    
-    // Segment Register for memory operands - Prefix group 2 (GCC Ordering)
-    if(ins->params[res->mem_oper - 1].type & ((u64) 0x7 << 56))
-      *opcode_dest = ((u8[]) { 0x26, 0x2e, 0x36, 0x3e, 0x64, 0x65 })[((ins->params[res->mem_oper - 1].type >> 56) & 0x7) - 1], opcode_dest ++;
-  
-    // 67H prefix - Prefix group 4 (GCC Ordering)
-    if(ins->params[res->mem_oper - 1].value & ((u64) 0x1 << 60))
-      *opcode_dest = 0x67, opcode_dest ++;
-  }
-
   // Only for Normal **NON** VEX and EVEX instructions
-  if(!res->vex) {
+  if(!vex) {
     
     // 66H prefix - Prefix group 3 (GCC Ordering) + FWAIT and Prefix Group 1
     if(res->prefixes) {
@@ -9440,7 +9565,7 @@ static u32 encode(const x64Ins* ins, x64LookupActualIns* res, u8* opcode_dest) {
   opcode_dest += res->oplen;
 
   // ModR/M | MOD = XX, REG = XXX, RM = XXX | https://wiki.osdev.org/X86-64_Instruction_Encoding#:~:text=r/m-,32/64%2Dbit%20addressing,-These%20are%20the
-  if(res->modrmreq) {
+  if(layout == X64_ENC_MODRM) {
     u8 modrm = res->modrm;
     const x64Operand* rm = ins->params + res->mem_oper - 1;
 
@@ -9461,7 +9586,7 @@ static u32 encode(const x64Ins* ins, x64LookupActualIns* res, u8* opcode_dest) {
         const i32 value = (i32) rm->value;
 
         if(base & 0x10) { // No base register => SIB byte without base.
-          u8 sib = (index | 0x10) ? 0x25/* Scale = 00, Index = 100, Base = 101, both null*/ : memscale(rm->value) << 6 | (index & 0x7) << 3 | 0x5;
+          u8 sib = (index & 0x10) ? 0x25/* Scale = 00, Index = 100, Base = 101, both null*/ : memscale(rm->value) << 6 | (index & 0x7) << 3 | 0x5;
           *opcode_dest = modrm | 0x04 /* MOD = 00, REG = XXX, RM = 100 */, *(opcode_dest + 1) = sib;
           *(i32*) (opcode_dest + 2) = value; // I don't know why, but when the base is null, there's always a 32 bit displacement encoded with the ModR/M + SIB byte.
           opcode_dest += 6;
@@ -9497,43 +9622,155 @@ static u32 encode(const x64Ins* ins, x64LookupActualIns* res, u8* opcode_dest) {
         else if(base == $esp) // Special case for ESP/RSP without displacement since ESP as base for the RM means that SIB is used.
           *opcode_dest = modrm | 0x04 /* MOD = 00, REG = XXX, RM = 100 */, *(opcode_dest + 1) = 0x24 /* Scale = 00, Index = 100, Base = 100 */, opcode_dest += 2;
         else if(base == $ebp) // Special case for register EBP/R13 without displacement because with mod = 00, r13 = rip
-          *opcode_dest = 0x45 /* MOD = 01, REG = XXX, RM = 101 */, *(opcode_dest + 1) = 0 /* 1 Byte/8 Bit Disp */, opcode_dest ++;
+          *opcode_dest = modrm | 0x45 /* MOD = 01, REG = XXX, RM = 101 */, *(opcode_dest + 1) = 0 /* 1 Byte/8 Bit Disp */, opcode_dest += 2;
         else *opcode_dest = modrm | base, opcode_dest ++;
       }
     } else *opcode_dest = modrm | 0xC0 | (rm->value & 0x7) /* MOD = 11, REG = XXX, RM = XXX */, opcode_dest ++; // Is not a memory operand, so RM is the register number.
   }
 
   // For instructions that have +rw, +rd etc
-  else if(res->reg_oper)
+  else if(layout == X64_ENC_OPREG)
     *(opcode_dest - 1) |= (ins->params[res->reg_oper - 1].value & 0x7);
 
 end:
-  if(res->imm_oper) {
-    u32 size = res->args[res->imm_oper - 1] >> 1;
-    switch(size) {
-    case 1: *       opcode_dest = ins->params[res->imm_oper - 1].value; break;
-    case 2: *(i16*) opcode_dest = ins->params[res->imm_oper - 1].value; break;
-    case 4: *(i32*) opcode_dest = ins->params[res->imm_oper - 1].value; break;
-    case 8: *(i64*) opcode_dest = ins->params[res->imm_oper - 1].value; break;
+  switch(trailer) {
+  case X64_ENC_IMM8:  *       opcode_dest = ins->params[res->imm_oper - 1].value, opcode_dest += 1; break;
+  case X64_ENC_IMM16: *(i16*) opcode_dest = ins->params[res->imm_oper - 1].value, opcode_dest += 2; break;
+  case X64_ENC_IMM32: *(i32*) opcode_dest = ins->params[res->imm_oper - 1].value, opcode_dest += 4; break;
+  case X64_ENC_IMM64: *(i64*) opcode_dest = ins->params[res->imm_oper - 1].value, opcode_dest += 8; break;
+
+  // Relative displacement for instructions like JMP
+  case X64_ENC_REL8:  *       opcode_dest = ins->params[res->rel_oper - 1].value, opcode_dest += 1; break;
+  case X64_ENC_REL32: *(i32*) opcode_dest = ins->params[res->rel_oper - 1].value, opcode_dest += 4; break; // HAS to be Rel32 for x64.
+
+  case X64_ENC_IS4: *opcode_dest = (u8) ins->params[res->is4_oper - 1].value << 4, opcode_dest ++; break;
+  }
+
+  return opcode_dest - opcode_dest_start;
+}
+
+static u8 encoding_class(const x64LookupActualIns* res) {
+  u8 layout = res->modrmreq ? X64_ENC_MODRM : res->reg_oper ? X64_ENC_OPREG : X64_ENC_NOMODRM;
+  u8 trailer = X64_ENC_NONE;
+  if(res->imm_oper)
+    switch(res->args[res->imm_oper - 1] >> 1) {
+    case 1: trailer = X64_ENC_IMM8; break;
+    case 2: trailer = X64_ENC_IMM16; break;
+    case 4: trailer = X64_ENC_IMM32; break;
+    case 8: trailer = X64_ENC_IMM64; break;
     }
-    opcode_dest += size;
+  else if(res->rel_oper) trailer = res->args[res->rel_oper - 1] == REL8 ? X64_ENC_REL8 : X64_ENC_REL32;
+  else if(res->is4_oper) trailer = X64_ENC_IS4;
+  return X64_ENC_CLASS(!!res->vex, layout, trailer);
+}
+
+static u32 encode_generic(const x64Ins* ins, const x64LookupActualIns* res, u8* opcode_dest) {
+  u8 class = encoding_class(res);
+  return encode_form(ins, res, opcode_dest, class / 24, class / 8 % 3, class % 8);
+}
+
+// Enter is the weirdest instruction ever :'(
+static u32 encode_enter(const x64Ins* ins, const x64LookupActualIns* res, u8* opcode_dest) {
+  (void) res;
+  *(u32*) opcode_dest = (u32) 0xC8 | (u32) ((u16) ins->params[0].value) << 8 | (u32) ((u8) ins->params[1].value) << 24;
+  return 4;
+}
+
+// Every class some form in x64Table uses. Any other class still works through encode_generic.
+#define X64_ENC_CLASSES(X) \
+  X(0, NOMODRM, NONE) X(0, NOMODRM, IMM8) X(0, NOMODRM, IMM16) X(0, NOMODRM, IMM32) X(0, NOMODRM, REL8) X(0, NOMODRM, REL32) \
+  X(0, OPREG, NONE) X(0, OPREG, IMM8) X(0, OPREG, IMM16) X(0, OPREG, IMM32) X(0, OPREG, IMM64) \
+  X(0, MODRM, NONE) X(0, MODRM, IMM8) X(0, MODRM, IMM16) X(0, MODRM, IMM32) X(0, MODRM, REL32) \
+  X(1, NOMODRM, NONE) X(1, OPREG, NONE) X(1, OPREG, IMM8) X(1, MODRM, NONE) X(1, MODRM, IMM8) X(1, MODRM, IS4)
+
+#define X64_ENC_DEFINE(vex, layout, trailer) \
+  static u32 encode_##vex##_##layout##_##trailer(const x64Ins* ins, const x64LookupActualIns* res, u8* opcode_dest) { \
+    return encode_form(ins, res, opcode_dest, vex, X64_ENC_##layout, X64_ENC_##trailer); \
   }
+X64_ENC_CLASSES(X64_ENC_DEFINE)
 
-  // Relative displacement for instructions like JMP
-  else if(res->rel_oper) {
-    if(res->args[res->rel_oper - 1] == REL8) {
-      *opcode_dest = ins->params[res->rel_oper - 1].value;
-      opcode_dest ++;
-    } else { // HAS to be Rel32 for x64.
-      *(i32*) opcode_dest = ins->params[res->rel_oper - 1].value;
-      opcode_dest += 4;
+#define X64_ENC_ENTRY(vex, layout, trailer) [X64_ENC_CLASS(vex, X64_ENC_##layout, X64_ENC_##trailer)] = encode_##vex##_##layout##_##trailer,
+static u32 (*const x64Encoders[])(const x64Ins* ins, const x64LookupActualIns* res, u8* opcode_dest) = {
+  X64_ENC_CLASSES(X64_ENC_ENTRY)
+  [X64_ENC_GENERIC] = encode_generic,
+  [X64_ENC_ENTER] = encode_enter,
+};
+
+// Points every form at its encoder once at load time.
+__attribute__((constructor)) static void encoder_init(void) {
+  for(u32 i = 0; i < sizeof(x64Table) / sizeof(x64LookupGeneralIns); i ++)
+    for(u32 f = 0; f < x64Table[i].numactualins; f ++) {
+      x64LookupActualIns* form = x64Table[i].ins + f;
+      form->enc = i + 1 == ENTER ? X64_ENC_ENTER : encoding_class(form);
+      if(!x64Encoders[form->enc]) form->enc = X64_ENC_GENERIC;
     }
+}
+
+static u32 encode(const x64Ins* ins, const x64LookupActualIns* res, u8* opcode_dest) {
+  if(!res) return 0;
+  return x64Encoders[res->enc](ins, res, opcode_dest);
+}
+
+// How many bytes encode() writes for `ins` in the form `res`, going through the same steps without writing any of them.
+static u32 form_size(const x64Ins* ins, const x64LookupActualIns* res) {
+  if(!res) return 0;
+  if(res->enc == X64_ENC_ENTER) return 4;
+
+  const u8 class = encoding_class(res);
+  const x64Operand* rm = res->mem_oper ? ins->params + res->mem_oper - 1 : NULL;
+  u32 size = res->oplen;
+
+  // Extension bits for registers past r7/xmm7, which need a REX prefix or the VEX 3 byte form.
+  bool ext_r = false, ext_x = false, ext_b = false;
+  if(res->reg_oper && ins->params[res->reg_oper - 1].value & 0x8) res->modrmreg ? (ext_r = true) : (ext_b = true);
+  if(rm) {
+    if(rm->value & ((u64) 0x7 << 56)) size ++; // Segment register
+    if(rm->value & ((u64) 0x1 << 60)) size ++; // 67H
+
+    if(ismem(rm->type)) {
+      if(membase(rm->value) & 0x8) ext_b = true;
+      if(memindex(rm->value) & 0x8) ext_x = true;
+    } else if(rm->value & 0x8) ext_b = true;
+  }
+
+  if(res->vex) size += (res->vex >> 4) || ext_x || ext_b ? 3 : 2;
+  else {
+    if(res->prefixes) size += res->preflen;
+    if(res->rex || ext_r || ext_x || ext_b) size ++;
   }
 
-  else if(res->is4_oper)
-    *opcode_dest = (u8) ins->params[res->is4_oper - 1].value << 4, opcode_dest ++;
+  if(class / 8 % 3 == X64_ENC_MODRM) {
+    size ++;
+    if(rm && ismem(rm->type) && !(rm->value & 0x2000000000000000)) {
+      u16 base = membase(rm->value);
+      u16 index = memindex(rm->value);
+      const i32 value = (i32) rm->value;
 
-  return opcode_dest - opcode_dest_start;
+      if(base & 0x10) size += 5; // SIB and disp32
+      else {
+        base &= 0x7;
+        if(value || index != 0x10) {
+          if(!(index & 0x10) || base == $esp) {
+            if(index == $esp)
+              return error(ASMERR_ESPRSP_USED_AS_INDEX, "ESP/RSP cannot be used as an index register for memory addressing! "
+                                                        "If not using scale, switch the base and index(esp/rsp), making esp/rsp the base.");
+            size ++;
+          }
+          if(value) size += value < 128 && value >= -128 ? 1 : 4;
+        }
+        else if(base == $esp || base == $ebp) size ++;
+      }
+    } else if(rm && ismem(rm->type)) size += 4; // RIP-relative disp32
+  }
+
+  switch(class % 8) {
+  case X64_ENC_IMM8: case X64_ENC_REL8: case X64_ENC_IS4: size += 1; break;
+  case X64_ENC_IMM16: size += 2; break;
+  case X64_ENC_IMM32: case X64_ENC_REL32: size += 4; break;
+  case X64_ENC_IMM64: size += 8; break;
+  }
+
+  return size;
 }
 
 
@@ -9542,6 +9779,118 @@ u32 x64emit(const x64Ins* ins, u8* opcode_dest) {
   return encode(ins, res, opcode_dest);
 }
 
+u32 x64size(const x64Ins* ins) {
+  return form_size(ins, identify(ins));
+}
+
+u32 x64sizen(const x64 p, u32 num, u32* offsets) {
+  u32 codelen = 0;
+  for(u32 i = 0; i < num; i ++) {
+    if(offsets) offsets[i] = codelen;
+    u32 curlen = form_size(p + i, identify(p + i));
+    if(!curlen) return 0;
+    codelen += curlen;
+  }
+  if(offsets) offsets[num] = codelen;
+  return codelen;
+}
+
+u32 x64emitn(const x64 p, u32 num, u8* opcode_dest, u32* offsets, u32* len) {
+  u32 codelen = 0, i = 0;
+  for(; i < num; i ++) {
+    if(offsets) offsets[i] = codelen;
+    u32 curlen = encode(p + i, identify(p + i), opcode_dest + codelen);
+    if(!curlen) break;
+    codelen += curlen;
+  }
+
+  if(len) *len = codelen;
+  return i;
+}
+
+const x64Prepared* x64prepare(const x64Ins* ins) {
+  return identify(ins);
+}
+
+u32 x64emit_prepared(const x64Prepared* prep, const x64Ins* ins, u8* opcode_dest) {
+  return encode(ins, prep, opcode_dest);
+}
+
+
+// ------------------------------------ Packed IR ------------------------------------ //
+
+// Every operand type x64Packed can hold, indexed by its `types`. Covers all of the operand macros in asm_x64.h.
+static const u64 x64PackedTypes[] = {
+  NONE,
+  ONE | IMM8 | IMM16 | IMM32 | IMM64, IMM8 | IMM16 | IMM32 | IMM64, ONE | IMM64, IMM64, ONE | IMM32, IMM32, ONE | IMM16, IMM16, ONE | IMM8, IMM8,
+  REL32 | REL8, REL32, REL8, X64_LABEL_REF | REL32 | REL8, X64_LABEL_REF,
+  X64_ALLMEMMASK, M8, M16, M32, M64, M128, M256, M512, FARPTR1616, FARPTR1632, FARPTR1664,
+  MOFFS8, MOFFS16, MOFFS32, MOFFS64,
+  AL | R8, CL | R8, R8, RH, AX | R16, DX | R16, R16, EAX | R32, R32, RAX | R64, R64,
+  MM, XMM_0 | XMM, XMM, YMM, ZMM, FS | SREG, GS | SREG, SREG, ST_0 | ST, ST, CR0_7, CR8, DREG,
+  PREF66, PREFREX_W, FAR, X64_ABS_REF | REL32,
+};
+
+#define X64_PACKED_MEM (X64_ALLMEMMASK | FARPTR1616 | FARPTR1632 | FARPTR1664)
+#define X64_PACKED_VALUE (IMM8 | IMM16 | IMM32 | IMM64 | REL8 | REL32 | X64_LABEL_REF | X64_ABS_REF | MOFFS8 | MOFFS16 | MOFFS32 | MOFFS64)
+
+// Unpacks the instruction at `p`, returning how many slots it takes up.
+static inline u32 unpack(const x64Packed* p, x64Ins* ins) {
+  u32 slots = 1;
+  ins->op = p->op;
+  for(u32 j = 0; j < 4; j ++) {
+    const u64 type = x64PackedTypes[p->types[j] & 0x7f] | (p->types[j] & 0x80 ? X64_HOLE : 0);
+    ins->params[j].type = type;
+
+    if(type & (X64_PACKED_MEM | X64_PACKED_VALUE) && p->regs[j]) ins->params[j].value = p[slots ++].imm64;
+    else if(type & X64_PACKED_MEM) ins->params[j].value = (u64) p->mem << 32 | (u32) p->disp;
+    else if(type & X64_PACKED_VALUE) ins->params[j].value = p->value;
+    else ins->params[j].value = p->regs[j];
+  }
+  return slots;
+}
+
+u32 x64pack(const x64 p, u32 num, x64Packed* out) {
+  u32 slots = 0;
+  for(u32 i = 0; i < num; i ++) {
+    x64Packed* packed = out + slots ++;
+    *packed = (x64Packed) { .op = p[i].op };
+
+    bool mem = false, value = false;
+    for(u32 j = 0; j < 4; j ++) {
+      const x64Operand* o = p[i].params + j;
+      const u64 type = o->type & ~X64_HOLE;
+
+      u32 class = 0;
+      while(class < sizeof(x64PackedTypes) / sizeof(u64) && x64PackedTypes[class] != type) class ++;
+      if(class == sizeof(x64PackedTypes) / sizeof(u64))
+        return error(ASMERR_UNPACKABLE_OPERAND, "Operand %d of ins '%s' has a type that can't be packed.", j + 1, x64stringify(p + i, 1));
+      packed->types[j] = class | (o->type & X64_HOLE ? 0x80 : 0);
+
+      // The first memory operand and the first value that fits in 32 bits are stored inline, anything else in the next slots.
+      if(type & X64_PACKED_MEM && !mem) mem = true, packed->mem = (u64) o->value >> 32, packed->disp = o->value;
+      else if(type & X64_PACKED_VALUE && !value && o->value == (i32) o->value) value = true, packed->value = o->value;
+      else if(type & (X64_PACKED_MEM | X64_PACKED_VALUE)) packed->regs[j] = 1, out[slots ++].imm64 = o->value;
+      else if((u64) o->value <= 0xff) packed->regs[j] = o->value;
+      else return error(ASMERR_UNPACKABLE_OPERAND, "Operand %d of ins '%s' has a value that can't be packed.", j + 1, x64stringify(p + i, 1));
+    }
+  }
+  return slots;
+}
+
+u32 x64unpack(const x64Packed* p, u32 num, x64Ins* out) {
+  u32 i = 0;
+  for(u32 slot = 0; slot < num; i ++)
+    slot += unpack(p + slot, out + i);
+  return i;
+}
+
+u32 x64emit_packed(const x64Packed* p, u8* opcode_dest) {
+  x64Ins ins;
+  unpack(p, &ins);
+  return encode(&ins, identify(&ins), opcode_dest);
+}
+
 
 static const char* reg_stringify(const x64Operand* reg) {
   if(reg->type & R8) return ((const char*[]){ "al", "cl", "dl", "bl", "sil", "dil", "bpl", "spl", "r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b" })[reg->value & 0xF];
@@ -9576,7 +9925,7 @@ char* x64stringify(const x64 p, u32 num) {
   if(!num) return "";
   
   u32 mallocsize = num * 20 + 50;
-  char* code = malloc(mallocsize);
+  char* code = ASM_X64_MALLOC(mallocsize);
   u32 cursize = 0;
   u32 curins = 0;
   u8 tab;
@@ -9588,6 +9937,28 @@ char* x64stringify(const x64 p, u32 num) {
   }
 
   while (num --) {
+    if (p[curins].op == X64_LABEL_DEF) {
+      cursize += sprintf(code + cursize, "L%u:", (u32) p[curins].params[0].value);
+      goto next;
+    }
+    if (p[curins].op == X64_SECTION) {
+      cursize += sprintf(code + cursize, ".section %u", (u32) p[curins].params[0].value);
+      goto next;
+    }
+    if (p[curins].op == X64_CONST) {
+      cursize += sprintf(code + cursize, ".const");
+      for(u32 i = 0; i < 4 && p[curins].params[i].type; i ++)
+        cursize += sprintf(code + cursize, "%c0x%llX", i ? ',' : ' ', (unsigned long long) p[curins].params[i].value);
+      goto next;
+    }
+    if (p[curins].op == X64_ALIGN) {
+      cursize += sprintf(code + cursize, ".align %u", (u32) p[curins].params[0].value);
+      goto next;
+    }
+    if (p[curins].op == X64_PATCH) {
+      cursize += sprintf(code + cursize, ".patch %u", (u32) p[curins].params[0].value);
+      goto next;
+    }
     if (p[curins].op > sizeof(x64Table) / sizeof(x64LookupGeneralIns) || p[curins].op < 1) {
       error(ASMERR_INVALID_INS, "Invalid instruction: %d.", p[curins].op);
       return NULL;
@@ -9614,7 +9985,7 @@ char* x64stringify(const x64 p, u32 num) {
         const char* reg = reg_stringify(p[curins].params + i);
         if(!reg) {
           error(ASMERR_INVALID_REG_TYPE, "Invalid register type: %llX", p[curins].params[i].type);
-          free(code);
+          ASM_X64_FREE(code);
           return NULL;
         }
         u32 reglen = strlen(reg);
@@ -9622,7 +9993,13 @@ char* x64stringify(const x64 p, u32 num) {
         cursize += reglen;
       }
       else if(p[curins].params[i].type & (IMM8 | IMM16 | IMM32 | IMM64))
-        cursize += sprintf(code + cursize, "0x%llX", p[curins].params[i].value);
+        cursize += sprintf(code + cursize, "0x%llX", (unsigned long long) p[curins].params[i].value);
+
+      else if(p[curins].params[i].type & X64_ABS_REF)
+        cursize += sprintf(code + cursize, "0x%llX", (unsigned long long) p[curins].params[i].value);
+
+      else if(p[curins].params[i].type & X64_LABEL_REF)
+        cursize += sprintf(code + cursize, "L%u", (u32) p[curins].params[i].value);
 
       else if(p[curins].params[i].type & (REL8 | REL32))
         cursize += sprintf(code + cursize, "$%+d", (u32) p[curins].params[i].value);
@@ -9631,9 +10008,6 @@ char* x64stringify(const x64 p, u32 num) {
       else if(p[curins].params[i].type & (X64_ALLMEMMASK | allfarmask) && p[curins].params[i].value & ((u64)1 << 62))
         cursize += sprintf(code + cursize, "[$%+d]", (u32) p[curins].params[i].value);
 
-      // else if(p[curins].params[i].type == X64_LABEL_REF)
-      //   cursize += sprintf(code + cursize, "%s", p[curins].label_name);
-
       else if(p[curins].params[i].type & (X64_ALLMEMMASK | allfarmask)) {
 
         if(p[curins].params[i].type != X64_ALLMEMMASK) {
@@ -9688,13 +10062,14 @@ char* x64stringify(const x64 p, u32 num) {
       }
     }
 
+next:
     // If there is a next instruction, add a newline.
     if(num > 0)
-      *((u16*) code + cursize) = (u16) ('\n' << 8) | '\t', cursize += 2;
+      code[cursize] = '\n', code[cursize + 1] = '\t', cursize += 2;
 
     if(cursize + 50 >= mallocsize) {
       mallocsize += 100 + num * 20;
-      code = realloc(code, mallocsize);
+      code = ASM_X64_REALLOC(code, mallocsize);
     }
     curins ++;
   }
@@ -9704,10 +10079,53 @@ char* x64stringify(const x64 p, u32 num) {
 }
 
 
+// Padding that's laid out along with the relatives, and only keeps how much of it is needed in `grow`.
+enum x64Padding {
+  X64_PAD_NONE,
+  X64_PAD_ALIGN, // An align(), padding after itself
+  X64_PAD_JCC, // Padding before a jump, or the instructions macro-fused with it, up to `target`, for X64_MODE_JCC_ERRATUM
+  X64_PAD_PATCH, // A patch_point(), padding after itself so the `target` bytes `size` bytes into the next instruction share a word
+};
+
 struct x64_relative {
   u32 ins; bool relref; // regular relative or riprel
-  u8 size; u8 param;
-  x64LookupActualIns* res;
+  u8 padding; // Padding instead of a relative, from x64Padding
+  bool absolute; // A relptr(), with `target` indexing the veneers instead
+  u32 slot; // Slot the instruction starts at in packed code, the most padding an align() takes or the ID of a patch point
+  u32 target; // Instruction referenced, label ID until labels are resolved, what an align() aligns to, the end of a jump or the
+              // size of what a patch point patches
+  bool label;
+  u8 size; u8 param; // Size and index of the rel() operand, or the byte padding is filled with
+  bool widenable; // Whether a rel8 is allowed to and has a rel32 form
+  u32 grow; // How many bytes longer the rel32 form is than the rel8 one it was first encoded as, once widened
+  const x64LookupActualIns* res; // Form of a riprel, or the rel32 form a rel8 got widened into
+};
+
+// A constant from pool8() and friends, laid out in the pool after the code.
+struct x64_constant {
+  u32 ins;
+  u32 size;
+  u32 same; // The first constant with the same bytes, which is the only one that takes up space in the pool
+  u32 offset;
+  u64 value[4];
+};
+
+// A relptr() from instruction `ins`, which gets a veneer after the code unless it reaches `address` directly.
+struct x64_veneer {
+  u64 address;
+  u32 ins;
+  u32 same; // The first veneer to the same address, which is the only one laid out, or UINT32_MAX if it isn't needed
+  u32 offset;
+};
+
+// Veneers are a `jmp [rip]` followed by the address it jumps to, which reaches anywhere from anywhere.
+#define X64_VENEER_SIZE 14
+
+// Instructions from `ins` up to the next run's are in `section`, and their relatives start at `rel`.
+struct x64_run {
+  u32 ins;
+  u32 section;
+  u32 rel;
 };
 
 // static inline u32 fnv1a(const char* data) {
@@ -9726,211 +10144,1636 @@ struct x64_relative {
 // }
 
 
-/**
-Current Problems with label-based linking:
-  - Need to completely change the original instruction and re-identify the instruction when trying to reduce the size of JMP / JCC instructions, since labels don't have a size.
-  - Need to keep re-calculating all of the instruction distances when a jump instruction changes size, as there can be jumps inside the area jumped over.
-  - Need to have a format that supports bringing different code together with different labels to allow them to link together
-
-union x64MCode {
-  u8 bytes[16];
-  struct {
-    u8 len;
-    u8 data[15];
-  };
-};
-typedef union x64MCode x64MCode;
 
-struct x64AssemblyRes {
-  x64MCode* code;
-  u32 code_len;
-  struct x64Relocatable {
-    x64Op op;
-    
-  }* reloc;
-};
+// Bytes taken up by whatever an instruction encodes after its displacement.
+static inline u32 trailer_size(const x64LookupActualIns* res) {
+  if(res->imm_oper) return res->args[res->imm_oper - 1] >> 1;
+  if(res->rel_oper) return res->args[res->rel_oper - 1] == REL8 ? 1 : 4;
+  return res->is4_oper ? 1 : 0;
+}
 
-So I just want to release this tbh, I will hold off on label based linking and string storage.
-*/
+static inline bool has_rel_form(x64Op op, u32 param, u64 type) {
+  for(u32 i = 0; i < x64Table[op - 1].numactualins; i ++)
+    if(x64Table[op - 1].ins[i].args[param] == type) return true;
+  return false;
+}
 
-u8* x64as(const x64 p, u32 num, u32* len) {
-  u32 code_size = num * 15;// 15 is the maximum size of 1 instruction. Example: lwpval rax, cs:[rax+rbx*8+0x23829382], 100000000
-  u32 indexes_size = num * sizeof(u16);
-  u32 relref_size = num * sizeof(struct x64_relative);
+// Grows `*p` to fit at least `need` elements of `size` bytes. Fails past UINT32_MAX of them, which `cap` can't count.
+static inline bool grow(void** p, u32* cap, u64 need, u32 size) {
+  if(need <= *cap) return true;
+  if(need > UINT32_MAX) return false;
+  u64 newcap = *cap ? *cap : 64;
+  while(newcap < need) newcap *= 2;
+  if(newcap > UINT32_MAX) newcap = UINT32_MAX;
 
-  u8 *const encoding_arena = calloc(code_size + indexes_size + relref_size, 1);
-  u8 *const code = encoding_arena;
-  u16 *const indexes = (u16*) (encoding_arena + code_size);
-  struct x64_relative *const relrefidxes = (struct x64_relative*) (encoding_arena + code_size + indexes_size);
-  // 2048 * 15 + 2048 * 2 + 2048 * 16 = 67584, about 33x more memory than instructions :skull:
+  void* grown = ASM_X64_REALLOC(*p, (size_t) newcap * size);
+  if(!grown) return false;
+  *p = grown, *cap = newcap;
+  return true;
+}
 
-  *len = 0;
-  u32 codelen = 0;
-  u32 index = 0;
-  u32 relreflen = 0;
-  
-  while (num --) {
-    x64LookupActualIns* res = identify(p + index);
-    int curlen = encode(p + index, res, code + codelen);
-    if(!curlen) goto error;
+// Index of the rel() operand `identify()` has to be steered for, or -1 if there isn't one.
+static inline int rel_param(const x64Ins* ins) {
+  if(ins->op < 1 || ins->op > sizeof(x64Table) / sizeof(x64LookupGeneralIns)) return -1;
+  for(int j = 0; j < 4 && ins->params[j].type; j ++)
+    if(ins->params[j].type & (REL8 | REL32) && !(ins->params[j].type & X64_HOLE)) return j;
+  return -1;
+}
 
-    if(res->rel_oper) {
-      i32 insns = p[index].params[res->rel_oper - 1].value;
+// The instruction `rel` is in, with its rel() widened to a rel32 pointing nowhere yet.
+static inline x64Ins widen(const x64 p, const x64Packed* packed, const struct x64_relative* rel) {
+  x64Ins widened;
+  if(packed) unpack(packed + rel->slot, &widened);
+  else widened = p[rel->ins];
+  widened.params[rel->param] = (x64Operand) { REL32, 0 };
+  return widened;
+}
 
-      // we don't need relrefs if the value was negative
-      if(insns <= 1) {
-        if(insns + index < 0) {
-          error(ASMERR_REL_OUT_OF_RANGE, "Relative reference out of range on ins '%s'", x64stringify(p + index, 1));
-          goto error;
-        }
+// Fills `size` bytes with as few NOPs as possible, in the forms the Intel SDM recommends, or with INT3s if `fill` is 0xCC.
+static void pad(u8* at, u32 size, u8 fill) {
+  static const u8 nops[9][9] = {
+    { 0x90 }, { 0x66, 0x90 }, { 0x0f, 0x1f, 0x00 }, { 0x0f, 0x1f, 0x40, 0x00 }, { 0x0f, 0x1f, 0x44, 0x00, 0x00 },
+    { 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00 }, { 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00 },
+    { 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  };
 
-        i32 offset;
+  if(fill == 0xcc) {
+    memset(at, 0xcc, size);
+    return;
+  }
+  for(; size > 9; size -= 9, at += 9) memcpy(at, nops[8], 9);
+  if(size) memcpy(at, nops[size - 1], size);
+}
 
-        if(insns == 1) offset = 0;
-        else if (insns == 0) offset = -curlen;
-        else offset = indexes[index + insns] - curlen;
+// Writes what `rel` grew by for the instruction at `at`, which is the whole rel32 form of a widened jump, the padding of an
+// align() or the padding before a jump.
+static inline void write_grown(const x64 p, const x64Packed* packed, const struct x64_relative* rel, u8* at) {
+  if(rel->padding) {
+    pad(rel->padding == X64_PAD_JCC ? at - rel->grow : at, rel->grow, rel->param);
+    return;
+  }
+  const x64Ins widened = widen(p, packed, rel);
+  encode(&widened, rel->res, at);
+}
 
-        // JCC size is either 2, 3, 5 or 6 with 0f prefixes
-        if(curlen > 4) { // DOWNSIZE IF INSTRUCTION IS TOO BIG
-          if(offset >= -125) {
-            curlen -= 3;
-            if(offset != 0) offset -= 3;
-            goto downsize;
-          }
-upsize:
-          *(int*) (code + codelen + curlen - 4) = offset;
-        }
-        else if (curlen < 4) {
-          if(offset <= -128) { // UPSIZE IF INSTRUCTION IS TOO SMALL
-            curlen += 3;
-            if(offset != 0) offset += 3;
-            goto upsize;
-          }
-downsize:
-          code[codelen + curlen - 1] = (i8) offset;
-        }
-      } else {
-        relrefidxes[relreflen].ins = index;
-        relrefidxes[relreflen].res = res;
-        relrefidxes[relreflen].param = res->rel_oper - 1;
-        relrefidxes[relreflen].size = res->args[res->rel_oper - 1] == REL32 ? 4 : 1;
-        relreflen ++;
-      }
-    }
+// Side tables for assembling, kept per thread and reused across calls so small functions don't pay for allocating and
+// faulting them in every time. Freed with x64scratch_free().
+static _Thread_local struct x64Scratch {
+  u32* indexes; u32 indexescap;
+  struct x64_relative* relrefs; u32 relrefscap;
+  u32* labels; u32 labelscap;
+  struct x64_run* runs; u32 runscap;
+  struct x64_constant* consts; u32 constscap;
+  struct x64_veneer* veneers; u32 veneerscap;
+  u32* pool; u32 poolcap; // Hash table of constants and veneers, for finding duplicates
+  u32* patches; u32 patchescap; u32 patcheslen; // Where every patch point's site is, from the last call
+  u8* code; u32 codecap; // Copy of the code to lay the sections out from
+  u8* exec; u32 execcap; // Code from x64as_exec() that can't be assembled where it runs
+  x64Ins* norm; u32 normcap; // Instructions x64cache() looks up, with their labels renumbered
+} scratch;
 
-    // Identify riprels
-    else if(res->mem_oper && p[index].params[res->mem_oper - 1].value & 0x4000000000000000) {
-      i32 insns = p[index].params[res->mem_oper - 1].value;
+static _Thread_local u32 as_modes; // From x64as_mode()
 
-      // If resolving offsets for instructions that were already resolved, including the current instruction, take this fast path before adding work to the other for loop
-      if(insns <= 1) {
-        if(insns + index < 0) {
-          error(ASMERR_REL_OUT_OF_RANGE, "RIP Relative out of range on ins '%s'", x64stringify(p + index, 1));
-          goto error;
-        }
+void x64as_mode(u32 modes) {
+  as_modes = modes;
+}
 
-        i32 offset;
+// Whether `op` is a jump, call or return, which X64_MODE_JCC_ERRATUM keeps from crossing or ending on a 32 byte boundary.
+static inline bool is_branch(u32 op) {
+  return (op >= JA && op <= JMP) || op == CALL || op == RET;
+}
 
-        if(insns == 1) offset = 0;
-        else if (insns == 0) offset = -curlen;
-        else offset = indexes[index + insns] - codelen - curlen; // i don't like repeating code but this is just simpler.
-        
-        // Currently no better way other than to directly reencode.
-        x64Ins ins = p[index];
-        ins.params[res->mem_oper - 1].value &= ~((u64) 0xffffffff);
-        ins.params[res->mem_oper - 1].value |= ((u64) offset) & 0xffffffff;
-        encode(&ins, res, code + codelen); // THIS WILL ALWAYS BE THE SAME SIZE SO NO NEED TO MANIPULATE CURLEN, RIP SIB HAS A CONSTANT SIZE.
-      } else {
-        relrefidxes[relreflen].ins = index;
-        relrefidxes[relreflen].res = res;
-        relrefidxes[relreflen].param = res->mem_oper - 1;
-        relrefidxes[relreflen].relref = true;
-        relreflen ++;
-      }
-    }
+// Whether `op` is macro-fused with a Jcc right after it on the CPUs X64_MODE_JCC_ERRATUM is for.
+static inline bool is_fusible(u32 op, u32 next) {
+  return (op == CMP || op == TEST || op == ADD || op == SUB || op == AND || op == INC || op == DEC) &&
+         next >= JA && next <= JZ && next != JECXZ && next != JRCXZ;
+}
 
-    indexes[index] = codelen;
-    codelen += curlen;
+void x64scratch_free(void) {
+  ASM_X64_FREE(scratch.indexes);
+  ASM_X64_FREE(scratch.relrefs);
+  ASM_X64_FREE(scratch.labels);
+  ASM_X64_FREE(scratch.runs);
+  ASM_X64_FREE(scratch.consts);
+  ASM_X64_FREE(scratch.veneers);
+  ASM_X64_FREE(scratch.patches);
+  ASM_X64_FREE(scratch.pool);
+  ASM_X64_FREE(scratch.code);
+  ASM_X64_FREE(scratch.exec);
+  ASM_X64_FREE(scratch.norm);
+  scratch = (struct x64Scratch) { 0 };
+}
 
-    index ++;
-  }
+// Lays out the instructions from `from` up to `end` starting at `at`, every widened rel8 taking up `grow` more bytes than it
+// was first encoded in and all padding as much as it needs where it ends up. Returns where they end.
+static u32 lay_out_run(u32* layout, const u32* indexes, u32 from, u32 end, struct x64_relative* rels, u32 r, u32 relslen, u32 at) {
+  u32 shift = at - indexes[from];
+  for(u32 i = from; i < end; i ++) {
+    layout[i] = indexes[i] + shift;
+    for(; r < relslen && rels[r].ins == i; r ++) {
+      struct x64_relative *const rel = rels + r;
+      if(rel->padding == X64_PAD_ALIGN) {
+        const u32 padding = -layout[i] & (rel->target - 1);
+        rel->grow = padding <= rel->slot ? padding : 0;
+      }
 
-  for(u32 i = 0; i < relreflen; i ++) {
+      // Patch points only pad if what they patch would straddle 2 words.
+      else if(rel->padding == X64_PAD_PATCH) {
+        const u32 misaligned = (layout[i] + rel->size) & 7;
+        rel->grow = misaligned + rel->target > 8 ? 8 - misaligned : 0;
+      }
 
-    // Index of current instruction in `indexes`
-    u32 relidx = relrefidxes[i].ins;
-    const i64* insoffset = &p[relidx].params[relrefidxes[i].param].value;
-    i32 offset = indexes[relidx + /* The current instruction that is being resolved */ *(i32*) insoffset /* The offset of the relative */]
-                 - indexes[relidx + 1]; /* Added 1 because the offset is added to a rip pointing to the next instruction */
-    
-    if(relrefidxes[i].relref) {
-      // Currently no better way other than to directly reencode.
-      x64Ins ins = p[relidx];
-      ins.params[relrefidxes[i].param].value &= ~((u64) 0xffffffff);
-      ins.params[relrefidxes[i].param].value |= ((u64) offset) & 0xffffffff;
-      encode(&ins, relrefidxes[i].res, code + indexes[relidx]);
-    } else {
-      if(relrefidxes[i].size == 4) {
-        *(int*) (code + indexes[relidx + 1] - 4) = offset;
-      } else code[indexes[relidx + 1] - 1] = (i8) offset;
+      // Jumps that would cross or end on a 32 byte boundary start on the next one instead. Their relatives come right after.
+      else if(rel->padding == X64_PAD_JCC) {
+        u32 size = indexes[rel->target] - indexes[i];
+        for(u32 k = r + 1; k < relslen && rels[k].ins < rel->target; k ++) size += rels[k].grow;
+        rel->grow = layout[i] >> 5 != (layout[i] + size) >> 5 ? 32 - (layout[i] & 31) : 0;
+        layout[i] += rel->grow;
+      }
+      shift += rel->grow;
     }
   }
+  return indexes[end] + shift;
+}
 
-  *len = codelen;
-  return encoding_arena;
-error:
-  free(encoding_arena);
-  *len = 0;
-  return NULL;
+// Lays out the `num` instructions, one section after another in order of their IDs if there are `runs` of them, and returns
+// the total length.
+static u32 lay_out(u32* layout, const u32* indexes, u32 num, const struct x64_run* runs, u32 runslen,
+                   struct x64_relative* rels, u32 relslen) {
+  if(!runslen) return layout[num] = lay_out_run(layout, indexes, 0, num, rels, 0, relslen, 0);
+
+  u32 at = 0;
+  for(i64 section = -1, next;; section = next) {
+    next = INT64_MAX;
+    for(u32 k = 0; k < runslen; k ++)
+      if(runs[k].section > section && runs[k].section < next) next = runs[k].section;
+    if(next == INT64_MAX) break;
+
+    for(u32 k = 0; k < runslen; k ++)
+      if(runs[k].section == next)
+        at = lay_out_run(layout, indexes, runs[k].ins, k + 1 < runslen ? runs[k + 1].ins : num, rels, runs[k].rel, relslen, at);
+  }
+  return layout[num] = at;
 }
 
-#if defined _WIN32 || defined __CYGWIN__
+// Lays out the constant pool at `at`, biggest alignment first so only its start has to be padded, with the constants that
+// are the same as an earlier one sharing its bytes. Returns where the pool ends, or 0 if it couldn't be allocated.
+static u32 lay_out_pool(u32* layout, u32 at, struct x64_constant* consts, u32 constslen) {
+  u32 mask = 63;
+  while(mask < constslen * 2) mask = mask * 2 + 1;
+  if(!grow((void**) &scratch.pool, &scratch.poolcap, mask + 1, sizeof(u32))) return 0;
+  u32 *const table = scratch.pool;
+  memset(table, 0xff, (mask + 1) * sizeof(u32));
 
-// https://learn.microsoft.com/en-us/windows/win32/memory/memory-protection-constants
-#define PAGE_EXECUTE_READ 0x20
-#define PAGE_READWRITE 0x4
-// https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-virtualalloc
-#define MEM_COMMIT 0x00001000
-// https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-virtualfree
-#define MEM_RELEASE 0x8000
+  u32 maxalign = 1;
+  for(u32 i = 0; i < constslen; i ++) {
+    struct x64_constant *const c = consts + i;
+    u32 h = (c->value[0] ^ c->value[1] * 31 ^ c->value[2] * 961 ^ c->value[3] * 29791 ^ c->size) * 0x9E3779B97F4A7C15 >> 32 & mask;
+    for(; table[h] != UINT32_MAX; h = (h + 1) & mask)
+      if(consts[table[h]].size == c->size && !memcmp(consts[table[h]].value, c->value, sizeof(c->value))) break;
 
-__attribute((dllimport)) void* __attribute((stdcall)) VirtualAlloc(void* lpAddress, size_t dwSize, u32 flAllocationType, u32 flProtect);
-__attribute((dllimport)) int __attribute((stdcall)) VirtualProtect(void* lpAddress, size_t dwSize, u32 flNewProtect, u32* lpflOldProtect);
-__attribute((dllimport)) int __attribute((stdcall)) VirtualFree(void* lpAddress, size_t dwSize, u32 dwFreeType);
+    if(table[h] == UINT32_MAX) table[h] = i;
+    c->same = table[h];
 
-// Aligns to the next multiple of a, where a is a power of 2
-static inline u32 align(u32 n, u32 a) { return (n + a - 1) & ~(a - 1); }
-void (*x64exec(void* mem, u32 size))() {
-	u32 pagesize = 4096;
-	u32 alignedsize = align(size, pagesize);
+    const u32 align = c->size & -c->size;
+    if(align > maxalign) maxalign = align < 32 ? align : 32;
+  }
 
-	void* buf = VirtualAlloc(NULL, alignedsize, MEM_COMMIT, PAGE_READWRITE);
-	memcpy(buf, mem, size);
+  at = (at + maxalign - 1) & -maxalign;
+  for(u32 align = maxalign; align; align /= 2)
+    for(u32 i = 0; i < constslen; i ++) {
+      struct x64_constant *const c = consts + i;
+      const u32 calign = c->size & -c->size;
+      if(c->same == i && (calign < 32 ? calign : 32) == align) c->offset = at, at += c->size;
+    }
 
-	u32 old;
-	VirtualProtect(buf, size, PAGE_EXECUTE_READ, &old);
-	return buf;
+  for(u32 i = 0; i < constslen; i ++) layout[consts[i].ins] = consts[consts[i].same].offset;
+  return at;
 }
 
-void x64exec_free(void* buf, u32 size) {
-  VirtualFree(buf, 0, MEM_RELEASE);
-  (void)size;
-}
+// Lays out a veneer from `at` on for every address in `veneers` that needs one, only once for each address. Returns the end of
+// the veneers, or 0 if it ran out of memory.
+static u32 lay_out_veneers(u32 at, struct x64_veneer* veneers, u32 veneerslen) {
+  u32 mask = 63;
+  while(mask < veneerslen * 2) mask = mask * 2 + 1;
+  if(!grow((void**) &scratch.pool, &scratch.poolcap, mask + 1, sizeof(u32))) return 0;
+  u32 *const table = scratch.pool;
+  memset(table, 0xff, (mask + 1) * sizeof(u32));
 
-#else
-#include <sys/mman.h>
-#include <unistd.h>
+  for(u32 i = 0; i < veneerslen; i ++) {
+    struct x64_veneer *const v = veneers + i;
+    if(v->same == UINT32_MAX) continue;
 
-void (*x64exec(void* mem, u32 size))() {\
-	void* buf = mmap(NULL, size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANON, -1, 0);
-	memcpy(buf, mem, size);
+    u32 h = v->address * 0x9E3779B97F4A7C15 >> 32 & mask;
+    for(; table[h] != UINT32_MAX; h = (h + 1) & mask)
+      if(veneers[table[h]].address == v->address) break;
 
-	mprotect(buf, size, PROT_READ | PROT_EXEC);
-	return buf;
+    if(table[h] == UINT32_MAX) table[h] = i, v->offset = at, at += X64_VENEER_SIZE;
+    v->same = table[h];
+  }
+  return at;
 }
 
-void x64exec_free(void* buf, u32 size) {
-  munmap(buf, size);
-}
+// Assembles `p`, or the `num` slots of `packed` if it's not NULL, storing where every instruction starts in `offsets` (+ the
+// end after the last one) if it's not NULL. Assembles into `dest` if it's not NULL, failing if the code doesn't fit in
+// `cap` bytes, otherwise into a buffer it allocates. `base` is the address the code runs at, or 0 if it isn't known.
+//
+// Every rel() starts out as a rel8 where the instruction has one, and only the ones that don't reach get widened to a rel32,
+// which can push other jumps out of range, so it's repeated until nothing grows anymore.
+//
+// Code after a sect() is encoded in place like any other, and only moved into its section once every jump is sized. The
+// padding of align()s and X64_MODE_JCC_ERRATUM is only known then too, so it's laid out along with the jumps. Constants
+// always end up after all of that, where $riprels reach them with the same 32 bit displacement anywhere, right after the
+// veneers for relptr()s that don't reach their address from `base`.
+static u8* assemble(const x64 p, const x64Packed* packed, u32 num, u8* dest, u32 cap, u32* len, u32* offsets, u64 base) {
+  // Most instructions are under 8 bytes, and the code grows if they aren't, so it only takes as much memory as it needs to.
+  u32 codecap = dest ? cap : (num < 0x1000000 ? num : 0x1000000) * 8 + 15; // 15 is the maximum size of 1 instruction. Example: lwpval rax, cs:[rax+rbx*8+0x23829382], 100000000
+  u8* code = dest ? dest : ASM_X64_MALLOC(codecap);
 
-#endif
+  *len = 0;
+  scratch.patcheslen = 0;
+  u32 codelen = 0;
+  u32 index = 0;
+  u32 relreflen = 0;
+  u32 slot = 0;
+  u32 labelslen = 0; // Labels past this haven't been cleared since the last call.
+  u32 runslen = 0; // Stays 0 unless there's a sect(), for everything to be laid out in one piece.
+  u32 constslen = 0;
+  u32 veneerslen = 0;
+  u32 patcheslen = 0;
+  u32 patching = UINT32_MAX; // The relative of the patch point the next instruction is for
+  bool padded = false;
+  const bool jcc_erratum = as_modes & X64_MODE_JCC_ERRATUM;
+  u32 unitend = 0; // End of the last jump padded for X64_MODE_JCC_ERRATUM, so the Jcc of a fused pair isn't padded again.
+
+  // Where each instruction was first encoded, and where it ends up after widening.
+  if(!code || !grow((void**) &scratch.indexes, &scratch.indexescap, ((u64) num + 1) * 2, sizeof(u32))) goto oom;
+  u32 *const indexes = scratch.indexes, *const layout = indexes + num + 1;
+  
+  while (packed ? slot < num : index < num) {
+    if(!grow((void**) &scratch.relrefs, &scratch.relrefscap, relreflen + 2, sizeof(struct x64_relative))) goto oom;
+    struct x64_relative *const relrefidxes = scratch.relrefs;
+    relrefidxes[relreflen] = (struct x64_relative) { 0 };
+
+    // Near the end of a buffer that can't grow, instructions are encoded on the side to check that they fit first.
+    u8 tail[32];
+    u8* at = code + codelen;
+    if(codelen + sizeof(tail) > codecap) {
+      if(dest) at = tail;
+      else if(!grow((void**) &code, &codecap, codelen + sizeof(tail), 1)) goto oom;
+      else at = code + codelen;
+    }
+
+    x64Ins unpacked;
+    const x64Ins* ins = p + index;
+    const u32 insslot = slot;
+    if(packed) ins = &unpacked, slot += unpack(packed + slot, &unpacked);
+
+    // Label definitions take up no space, so they point to the start of the instruction after them.
+    if(ins->op == X64_LABEL_DEF) {
+      const u32 id = ins->params[0].value;
+      if(ins->params[0].value > X64_MAX_LABEL) {
+        error(ASMERR_INVALID_LABEL, "Label %llu at instruction %u is past X64_MAX_LABEL.", (unsigned long long) ins->params[0].value, index);
+        goto error;
+      }
+      if(id >= labelslen) {
+        if(!grow((void**) &scratch.labels, &scratch.labelscap, id + 1, sizeof(u32))) goto oom;
+        memset(scratch.labels + labelslen, 0xff, (id + 1 - labelslen) * sizeof(u32));
+        labelslen = id + 1;
+      }
+      u32 *const labels = scratch.labels;
+      if(labels[id] != UINT32_MAX) {
+        error(ASMERR_INVALID_LABEL, "Label %u defined twice, at instruction %u and %u.", id, labels[id], index);
+        goto error;
+      }
+
+      labels[id] = index;
+      indexes[index] = layout[index] = codelen;
+      index ++;
+      continue;
+    }
+
+    // So do sections, which only start a new run of instructions.
+    if(ins->op == X64_SECTION) {
+      if(!grow((void**) &scratch.runs, &scratch.runscap, runslen + 2, sizeof(struct x64_run))) goto oom;
+      if(!runslen) scratch.runs[runslen ++] = (struct x64_run) { 0, X64_HOT, 0 };
+      scratch.runs[runslen ++] = (struct x64_run) { index, ins->params[0].value, relreflen };
+
+      indexes[index] = layout[index] = codelen;
+      index ++;
+      continue;
+    }
+
+    // So do constants, which go in the pool after the code.
+    if(ins->op == X64_CONST) {
+      if(!grow((void**) &scratch.consts, &scratch.constscap, constslen + 1, sizeof(struct x64_constant))) goto oom;
+      struct x64_constant *const c = scratch.consts + constslen ++;
+      *c = (struct x64_constant) { .ins = index };
+      for(u32 j = 0; j < 4 && ins->params[j].type; j ++) {
+        const u64 type = ins->params[j].type;
+        const u32 size = type & IMM64 ? 8 : type & IMM32 ? 4 : type & IMM16 ? 2 : 1;
+        memcpy((u8*) c->value + c->size, &ins->params[j].value, size);
+        c->size += size;
+      }
+      if(!c->size) {
+        error(ASMERR_INS_ARGUMENT_MISMATCH, "Constant at instruction %u is empty.", index);
+        goto error;
+      }
+
+      indexes[index] = layout[index] = codelen;
+      index ++;
+      continue;
+    }
+
+    // And aligns, until they're laid out.
+    if(ins->op == X64_ALIGN) {
+      const u32 alignment = ins->params[0].value;
+      if(!alignment || alignment & (alignment - 1)) {
+        error(ASMERR_INS_ARGUMENT_MISMATCH, "Can't align to %u bytes, it isn't a power of 2.", alignment);
+        goto error;
+      }
+
+      relrefidxes[relreflen ++] = (struct x64_relative) {
+        .ins = index, .padding = X64_PAD_ALIGN, .target = alignment,
+        .slot = ins->params[1].type ? ins->params[1].value : alignment - 1, .param = ins->params[2].type ? ins->params[2].value : 0x90,
+      };
+      padded = true;
+
+      indexes[index] = layout[index] = codelen;
+      index ++;
+      continue;
+    }
+
+    // And patch points, until what they patch is encoded and they're laid out.
+    if(ins->op == X64_PATCH) {
+      const u32 id = ins->params[0].value;
+      if(ins->params[0].value > X64_MAX_LABEL) {
+        error(ASMERR_INVALID_PATCH, "Patch point %llu at instruction %u is past X64_MAX_LABEL.", (unsigned long long) ins->params[0].value, index);
+        goto error;
+      }
+      if(id >= patcheslen) {
+        if(!grow((void**) &scratch.patches, &scratch.patchescap, id + 1, sizeof(u32))) goto oom;
+        memset(scratch.patches + patcheslen, 0xff, (id + 1 - patcheslen) * sizeof(u32));
+        patcheslen = id + 1;
+      }
+      if(scratch.patches[id] != UINT32_MAX || patching != UINT32_MAX) {
+        error(ASMERR_INVALID_PATCH, "Patch point %u at instruction %u is defined twice or right after another one.", id, index);
+        goto error;
+      }
+
+      scratch.patches[id] = index;
+      patching = relreflen;
+      relrefidxes[relreflen ++] = (struct x64_relative) { .ins = index, .padding = X64_PAD_PATCH, .slot = id, .param = 0x90 };
+      padded = true;
+
+      indexes[index] = layout[index] = codelen;
+      index ++;
+      continue;
+    }
+    if(patching != UINT32_MAX && relrefidxes[patching].ins + 1 != index) {
+      error(ASMERR_INVALID_PATCH, "Patch point at instruction %u isn't right before an instruction.", relrefidxes[patching].ins);
+      goto error;
+    }
+
+    // Padding before a jump has to come before its relative. Patch points are padded already, and moving them would undo it.
+    if(jcc_erratum && index >= unitend && patching == UINT32_MAX) {
+      const u32 next = packed ? (slot < num ? packed[slot].op : 0) : (index + 1 < num ? p[index + 1].op : 0);
+      const u32 unit = is_branch(ins->op) ? 1 : is_fusible(ins->op, next) ? 2 : 0;
+      if(unit) {
+        relrefidxes[relreflen ++] = (struct x64_relative) { .ins = index, .padding = X64_PAD_JCC, .target = index + unit, .param = 0x90 };
+        relrefidxes[relreflen] = (struct x64_relative) { 0 };
+        unitend = index + unit;
+        padded = true;
+      }
+    }
+
+    // Relative references are linked later, so they're encoded with a displacement of 0 in the smallest form they have.
+    x64Ins narrowed;
+    const x64Ins* original = ins;
+    const int param = rel_param(ins);
+    if(param >= 0) {
+      narrowed = *ins;
+      narrowed.params[param] = (x64Operand) { patching == UINT32_MAX && ins->params[param].type & REL8 && has_rel_form(ins->op, param, REL8) ? REL8 : REL32, 0 };
+      ins = &narrowed;
+    }
+
+    x64LookupActualIns* res = identify(ins);
+    int curlen = encode(ins, res, at);
+    if(!curlen) goto error;
+    if(at == tail) {
+      if(codelen + curlen > codecap) goto too_small;
+      memcpy(code + codelen, tail, curlen);
+    }
+
+    // What's patched is always last, so it's found from the end.
+    if(patching != UINT32_MAX) {
+      const u32 size = res->rel_oper ? 4 : res->imm_oper && res->enc != X64_ENC_ENTER ? trailer_size(res) : 0;
+      if(size != 4 && size != 8) {
+        error(ASMERR_INVALID_PATCH, "Instruction %u after a patch point has no rel32, imm32 or imm64 to patch.", index);
+        goto error;
+      }
+      relrefidxes[patching].target = size;
+      relrefidxes[patching].size = curlen - size;
+      patching = UINT32_MAX;
+    }
+
+    if(param >= 0 && original->params[param].type & X64_ABS_REF) {
+      if(!grow((void**) &scratch.veneers, &scratch.veneerscap, veneerslen + 1, sizeof(struct x64_veneer))) goto oom;
+      scratch.veneers[veneerslen] = (struct x64_veneer) { .address = original->params[param].value, .ins = index };
+      relrefidxes[relreflen ++] = (struct x64_relative) { .ins = index, .slot = insslot, .target = veneerslen ++, .absolute = true, .param = param, .size = 4 };
+    }
+
+    else if(param >= 0) {
+      const bool label = original->params[param].type & X64_LABEL_REF;
+      i64 target = label ? (u32) original->params[param].value : (i64) index + (i32) original->params[param].value;
+      if(target < 0) {
+        error(ASMERR_REL_OUT_OF_RANGE, "Relative reference out of range on ins '%s'", x64stringify(original, 1));
+        goto error;
+      }
+
+      relrefidxes[relreflen].ins = index;
+      relrefidxes[relreflen].slot = insslot;
+      relrefidxes[relreflen].target = target;
+      relrefidxes[relreflen].label = label;
+      relrefidxes[relreflen].param = param;
+      relrefidxes[relreflen].size = res->args[param] == REL32 ? 4 : 1;
+      relrefidxes[relreflen].widenable = original->params[param].type & REL32 && has_rel_form(ins->op, param, REL32);
+      relreflen ++;
+    }
+
+    // Identify riprels
+    else if(res->mem_oper && ins->params[res->mem_oper - 1].value & 0x4000000000000000) {
+      i64 target = (i64) index + (i32) ins->params[res->mem_oper - 1].value;
+      if(target < 0) {
+        error(ASMERR_REL_OUT_OF_RANGE, "RIP Relative out of range on ins '%s'", x64stringify(ins, 1));
+        goto error;
+      }
+
+      relrefidxes[relreflen].ins = index;
+      relrefidxes[relreflen].slot = insslot;
+      relrefidxes[relreflen].target = target;
+      relrefidxes[relreflen].res = res;
+      relrefidxes[relreflen].relref = true;
+      relreflen ++;
+    }
+
+    indexes[index] = layout[index] = codelen;
+    codelen += curlen;
+
+    index ++;
+  }
+  indexes[index] = layout[index] = codelen;
+  struct x64_relative *const relrefidxes = scratch.relrefs;
+  if(patching != UINT32_MAX) {
+    error(ASMERR_INVALID_PATCH, "Patch point at instruction %u isn't right before an instruction.", relrefidxes[patching].ins);
+    goto error;
+  }
+
+  // References past the end can only be caught once it's known where the end is, since packed code is counted in slots.
+  for(u32 i = 0; i < relreflen; i ++) {
+    struct x64_relative* rel = relrefidxes + i;
+    if(rel->padding || rel->absolute) continue;
+    if(rel->label) {
+      if(rel->target >= labelslen || scratch.labels[rel->target] == UINT32_MAX) {
+        error(ASMERR_INVALID_LABEL, "Label %u used by instruction %u is never defined.", rel->target, rel->ins);
+        goto error;
+      }
+      rel->target = scratch.labels[rel->target];
+    }
+    else if(rel->target > index) {
+      error(ASMERR_REL_OUT_OF_RANGE, "Relative reference out of range on instruction %u", rel->ins);
+      goto error;
+    }
+  }
+
+  if(runslen || padded) lay_out(layout, indexes, index, scratch.runs, runslen, relrefidxes, relreflen);
+
+  // Widens every rel8 that doesn't reach its target, until all of them do.
+  for(bool grew = true; grew;) {
+    grew = false;
+    for(u32 i = 0; i < relreflen; i ++) {
+      struct x64_relative* rel = relrefidxes + i;
+      if(rel->relref || rel->padding || rel->size == 4) continue;
+
+      const i32 offset = layout[rel->target] - (layout[rel->ins] + indexes[rel->ins + 1] - indexes[rel->ins]);
+      if(offset >= -128 && offset <= 127) continue;
+      if(!rel->widenable) {
+        error(ASMERR_REL_OUT_OF_RANGE, "Relative reference of %d bytes doesn't fit in the rel8 of instruction %u", offset, rel->ins);
+        goto error;
+      }
+
+      // Only the few jumps that need it get their rel32 form looked up.
+      const x64Ins widened = widen(p, packed, rel);
+      if(!(rel->res = identify(&widened))) goto error;
+      rel->grow = form_size(&widened, rel->res) - (indexes[rel->ins + 1] - indexes[rel->ins]);
+      rel->size = 4;
+      grew = true;
+    }
+    if(grew) lay_out(layout, indexes, index, scratch.runs, runslen, relrefidxes, relreflen);
+  }
+  const u32 growth = layout[index] - codelen;
+
+  if(dest && (u64) codelen + growth > codecap) goto too_small;
+  if(!dest && !grow((void**) &code, &codecap, (u64) codelen + growth, 1)) goto oom;
+
+  // Copies every run of instructions into its section, with the instructions between widened ones copied in one go.
+  if(runslen) {
+    if(!grow((void**) &scratch.code, &scratch.codecap, codelen, 1)) goto oom;
+    memcpy(scratch.code, code, codelen);
+
+    for(u32 k = 0, r = 0; k < runslen; k ++) {
+      const u32 end = k + 1 < runslen ? scratch.runs[k + 1].ins : index;
+      u32 from = scratch.runs[k].ins;
+      for(; r < relreflen && relrefidxes[r].ins < end; r ++) {
+        const struct x64_relative* rel = relrefidxes + r;
+        if(!rel->grow) continue;
+
+        memcpy(code + layout[from], scratch.code + indexes[from], indexes[rel->ins] - indexes[from]);
+        write_grown(p, packed, rel, code + layout[rel->ins]);
+        from = rel->padding == X64_PAD_JCC ? rel->ins : rel->ins + 1; // Padding before a jump leaves the jump to be copied
+      }
+      memcpy(code + layout[from], scratch.code + indexes[from], indexes[end] - indexes[from]);
+    }
+  }
+
+  // Moves the code after every widened instruction and padding into place, back to front so nothing is overwritten before
+  // it's moved.
+  else if(growth) {
+    u32 end = index;
+    for(u32 i = relreflen; i --;) {
+      const struct x64_relative* rel = relrefidxes + i;
+      if(!rel->grow) continue;
+
+      const u32 from = rel->padding == X64_PAD_JCC ? rel->ins : rel->ins + 1;
+      memmove(code + layout[from], code + indexes[from], indexes[end] - indexes[from]);
+      end = rel->ins;
+      write_grown(p, packed, rel, code + layout[rel->ins]);
+    }
+  }
+
+  // relptr()s are called and jumped to directly when the code is known to run within 2 GB of them, and through a veneer
+  // after the code otherwise.
+  u32 veneered = 0;
+  for(u32 i = 0; i < veneerslen; i ++) {
+    struct x64_veneer *const v = scratch.veneers + i;
+    const i64 disp = v->address - (base + layout[v->ins] + indexes[v->ins + 1] - indexes[v->ins]);
+    if(base && disp == (i32) disp) v->same = UINT32_MAX;
+    else veneered ++;
+  }
+  if(veneered) {
+    const u32 end = layout[index];
+    if(!(layout[index] = lay_out_veneers(end, scratch.veneers, veneerslen))) goto oom;
+    if(dest && layout[index] > codecap) goto too_small;
+    if(!dest && !grow((void**) &code, &codecap, layout[index], 1)) goto oom;
+
+    for(u32 i = 0; i < veneerslen; i ++) {
+      const struct x64_veneer* v = scratch.veneers + i;
+      if(v->same != i) continue;
+      memcpy(code + v->offset, (const u8[]) { 0xff, 0x25, 0, 0, 0, 0 }, 6);
+      memcpy(code + v->offset + 6, &v->address, 8);
+    }
+  }
+
+  // The pool goes after everything else, padded with INT3s up to its first constant.
+  if(constslen) {
+    const u32 end = layout[index];
+    if(!(layout[index] = lay_out_pool(layout, end, scratch.consts, constslen))) goto oom;
+    if(dest && layout[index] > codecap) goto too_small;
+    if(!dest && !grow((void**) &code, &codecap, layout[index], 1)) goto oom;
+
+    memset(code + end, 0xcc, layout[index] - end);
+    for(u32 i = 0; i < constslen; i ++) {
+      const struct x64_constant* c = scratch.consts + i;
+      if(c->same == i) memcpy(code + c->offset, c->value, c->size);
+    }
+  }
+
+  for(u32 i = 0; i < relreflen; i ++) {
+    const struct x64_relative* rel = relrefidxes + i;
+    if(rel->padding) continue;
+    const u32 next = layout[rel->ins] + indexes[rel->ins + 1] - indexes[rel->ins] + rel->grow; // Relatives are from the rip pointing to the next instruction
+    i32 offset = layout[rel->target] - next;
+    if(rel->absolute) {
+      const struct x64_veneer* v = scratch.veneers + rel->target;
+      offset = v->same == UINT32_MAX ? (i32) (v->address - (base + next)) : (i32) (scratch.veneers[v->same].offset - next);
+    }
+
+    if(rel->relref) *(i32*) (code + next - trailer_size(rel->res) - 4) = offset;
+    else if(rel->size == 4) *(i32*) (code + next - 4) = offset;
+    else code[next - 1] = (i8) offset;
+  }
+
+  for(u32 i = 0; i < relreflen; i ++) {
+    const struct x64_relative* rel = relrefidxes + i;
+    if(rel->padding == X64_PAD_PATCH) scratch.patches[rel->slot] = layout[rel->ins + 1] + rel->size;
+  }
+  scratch.patcheslen = patcheslen;
+
+  codelen = layout[index];
+  if(offsets) for(u32 i = 0; i <= index; i ++) offsets[i] = layout[i];
+
+  *len = codelen;
+  return code;
+too_small:
+  error(ASMERR_BUFFER_TOO_SMALL, "Code doesn't fit in the %u bytes given.", cap);
+  goto error;
+oom:
+  error(ASMERR_OUT_OF_MEMORY, "Out of memory assembling %u instructions.", num);
+error:
+  if(!dest) ASM_X64_FREE(code);
+  *len = 0;
+  return NULL;
+}
+
+u8* x64as(const x64 p, u32 num, u32* len) {
+  return assemble(p, NULL, num, NULL, 0, len, NULL, 0);
+}
+
+u32 x64as_into(const x64 p, u32 num, u8* dest, u32 cap) {
+  u32 len;
+  assemble(p, NULL, num, dest, cap, &len, NULL, 0);
+  return len;
+}
+
+u32 x64as_at(const x64 p, u32 num, u8* dest, u32 cap, u64 base) {
+  u32 len;
+  assemble(p, NULL, num, dest, cap, &len, NULL, base);
+  return len;
+}
+
+u32 x64patch_site(u32 id) {
+  return id < scratch.patcheslen ? scratch.patches[id] : UINT32_MAX;
+}
+
+u8* x64as_packed(const x64Packed* p, u32 num, u32* len) {
+  return assemble(NULL, p, num, NULL, 0, len, NULL, 0);
+}
+
+// ------------------------------------ Stencils ------------------------------------ //
+
+x64Stencil* x64stencil(const x64 p, u32 num) {
+  x64Stencil* stencil = NULL;
+
+  // No code makes an empty stencil, like it makes empty code with x64as().
+  if(!num) {
+    if(!(stencil = ASM_X64_MALLOC(sizeof(x64Stencil)))) return error(ASMERR_OUT_OF_MEMORY, "Out of memory making a stencil."), NULL;
+    *stencil = (x64Stencil) { .code = (u8*) (stencil + 1), .holes = (struct x64StencilHole*) (stencil + 1) };
+    return stencil;
+  }
+
+  u32 numholes = 0;
+  for(u32 i = 0; i < num; i ++)
+    for(u32 j = 0; j < 4; j ++)
+      numholes += (p[i].params[j].type & X64_HOLE) != 0;
+
+  // Holes get assembled with placeholder values that force their widest encoding, so any value fits later.
+  x64Ins* ins = ASM_X64_MALLOC(num * sizeof(x64Ins));
+  u32* offsets = ASM_X64_MALLOC((num + 1) * sizeof(u32));
+  struct x64StencilHole* holes = ASM_X64_MALLOC(numholes * sizeof(struct x64StencilHole) + 1);
+  const x64LookupActualIns** forms = ASM_X64_MALLOC(num * sizeof(x64LookupActualIns*));
+  u8* code = NULL;
+  u32 len = 0, hole = 0;
+  if(!ins || !offsets || !holes || !forms) goto oom;
+  memcpy(ins, p, num * sizeof(x64Ins));
+
+  for(u32 i = 0; i < num; i ++) {
+    forms[i] = NULL;
+    for(u32 j = 0; j < 4; j ++) {
+      x64Operand* op = ins[i].params + j;
+      if(!(op->type & X64_HOLE)) continue;
+
+      if(ismem(op->type)) {
+        if(op->value & 0x4000000000000000) {
+          error(ASMERR_INVALID_HOLE, "$riprel displacements can't be holes, on ins '%s'", x64stringify(p + i, 1));
+          goto error;
+        }
+        op->value = (op->value & ~(u64) 0xffffffff) | 0x80; // Past a disp8
+      } else if(op->type & (REL8 | REL32)) op->type = REL32 | X64_HOLE, op->value = 0;
+
+      // The value could be anything, so the implicit 1 forms don't fit, and `imm()` gets the widest size the instruction has.
+      else {
+        const u64 sizes = op->type & (IMM8 | IMM16 | IMM32 | IMM64);
+        op->type &= ~ONE;
+        for(u64 size = IMM64; size >= IMM8; size >>= 1)
+          if(sizes & size && (op->type = (op->type & ~sizes) | size, identify(ins + i))) break;
+      }
+    }
+    for(u32 j = 0; j < 4 && !forms[i]; j ++)
+      if(ins[i].params[j].type & X64_HOLE && !(forms[i] = identify(ins + i))) goto error;
+  }
+
+  if(!(code = assemble(ins, NULL, num, NULL, 0, &len, offsets, 0))) goto error;
+
+  for(u32 i = 0; i < num; i ++) {
+    if(!forms[i]) continue;
+    const x64LookupActualIns* res = forms[i];
+    const u32 end = offsets[i] + form_size(ins + i, res); // Not offsets[i + 1], padding or the pool can come after it
+
+    for(u32 j = 0; j < 4; j ++) {
+      if(!(p[i].params[j].type & X64_HOLE)) continue;
+      struct x64StencilHole* h = holes + hole ++;
+
+      if(ismem(p[i].params[j].type) && j + 1 == res->mem_oper && res->modrmreq)
+        h->width = 4, h->rel = false, h->offset = end - trailer_size(res) - 4;
+      else if(j + 1 == res->imm_oper && res->enc != X64_ENC_ENTER)
+        h->width = trailer_size(res), h->rel = false, h->offset = end - h->width;
+      else if(j + 1 == res->rel_oper)
+        h->width = 4, h->rel = true, h->offset = end - 4;
+      else {
+        error(ASMERR_INVALID_HOLE, "Operand %d can't be a hole on ins '%s'", j + 1, x64stringify(p + i, 1));
+        goto error;
+      }
+
+      // Puts back the values the placeholders replaced.
+      if(!h->rel) memcpy(code + h->offset, &p[i].params[j].value, h->width);
+    }
+  }
+
+  if(!(stencil = ASM_X64_MALLOC(sizeof(x64Stencil) + numholes * sizeof(struct x64StencilHole) + len))) goto oom;
+  stencil->holes = (struct x64StencilHole*) (stencil + 1);
+  stencil->code = (u8*) (stencil->holes + numholes);
+  stencil->numholes = numholes;
+  stencil->len = len;
+  memcpy(stencil->holes, holes, numholes * sizeof(struct x64StencilHole));
+  memcpy(stencil->code, code, len);
+
+error:
+  ASM_X64_FREE(ins);
+  ASM_X64_FREE(offsets);
+  ASM_X64_FREE(holes);
+  ASM_X64_FREE(forms);
+  ASM_X64_FREE(code);
+  return stencil;
+
+oom:
+  error(ASMERR_OUT_OF_MEMORY, "Out of memory making a stencil of %u instructions.", num);
+  goto error;
+}
+
+u32 x64stencil_emit(const x64Stencil* stencil, const i64* values, u8* opcode_dest) {
+  memcpy(opcode_dest, stencil->code, stencil->len);
+
+  for(u32 i = 0; i < stencil->numholes; i ++) {
+    const struct x64StencilHole* h = stencil->holes + i;
+    i64 value = h->rel ? values[i] - (i64) (opcode_dest + h->offset + 4) : values[i];
+    switch(h->width) {
+    case 1: *       (opcode_dest + h->offset) = value; break;
+    case 2: *(i16*) (opcode_dest + h->offset) = value; break;
+    case 4: *(i32*) (opcode_dest + h->offset) = value; break;
+    case 8: *(i64*) (opcode_dest + h->offset) = value; break;
+    }
+  }
+
+  return stencil->len;
+}
+
+// ------------------------------------ Streaming ------------------------------------ //
+
+struct x64Stream {
+  u8* code;
+  u32 len, cap;
+  u32* offsets; // Where every instruction pushed so far starts.
+  u32 num, offsetscap;
+  struct x64Fixup {
+    u32 target; // Index of the instruction referenced.
+    u32 at, end; // Where the displacement is and where it's relative to.
+    u8 size;
+  }* fixups;
+  u32 numfixups, fixupscap;
+  u32 nexttarget; // Lowest target of all fixups, so they're only looked through when one can be resolved.
+  bool failed;
+};
+
+// Writes a displacement of `size` bytes, erroring if it doesn't fit.
+static inline bool link_disp(u8* at, i64 disp, u8 size) {
+  if(size == 1) {
+    if(disp < -128 || disp > 127) return error(ASMERR_REL_OUT_OF_RANGE, "Relative reference of %lld bytes doesn't fit in a rel8.", (long long) disp);
+    *at = disp;
+  } else *(i32*) at = disp;
+  return true;
+}
+
+// Resolves all of the fixups pointing to `target` at `offset`.
+static bool resolve_fixups(x64Stream* s, u32 target, u32 offset) {
+  u32 kept = 0;
+  s->nexttarget = UINT32_MAX;
+  for(u32 i = 0; i < s->numfixups; i ++) {
+    struct x64Fixup* f = s->fixups + i;
+    if(f->target == target) {
+      if(!link_disp(s->code + f->at, (i64) offset - f->end, f->size)) return false;
+      continue;
+    }
+    if(f->target < s->nexttarget) s->nexttarget = f->target;
+    s->fixups[kept ++] = *f;
+  }
+  s->numfixups = kept;
+  return true;
+}
+
+x64Stream* x64stream(void) {
+  x64Stream* s = ASM_X64_CALLOC(1, sizeof(x64Stream));
+  if(s) s->nexttarget = UINT32_MAX;
+  return s;
+}
+
+u32 x64stream_push(x64Stream* s, const x64 p, u32 num) {
+  for(u32 i = 0; i < num; i ++) {
+    if(s->failed) return i;
+    if(!grow((void**) &s->code, &s->cap, (u64) s->len + 15, 1) || !grow((void**) &s->offsets, &s->offsetscap, s->num + 2, sizeof(u32)))
+      return error(ASMERR_OUT_OF_MEMORY, "Out of memory growing the stream."), i;
+
+    // This instruction is the target of earlier forward references.
+    if(s->nexttarget == s->num && !resolve_fixups(s, s->num, s->len)) return s->failed = true, i;
+    s->offsets[s->num] = s->len;
+
+    // Labels and the other pseudo-instructions need all of the code to lay it out, which a stream never has.
+    if(p[i].op >= X64_LABEL_DEF) {
+      const char* pseudo = x64stringify(p + i, 1);
+      if(pseudo) error(ASMERR_INVALID_INS, "Pseudo-instructions like '%s' aren't supported in streams, only by x64as().", pseudo);
+      return i;
+    }
+    for(u32 j = 0; j < 4; j ++)
+      if(p[i].params[j].type & X64_LABEL_REF)
+        return error(ASMERR_INVALID_LABEL, "lb() isn't supported in streams, on ins '%s'", x64stringify(p + i, 1)), i;
+
+    // identify() narrows small rel()s to a REL8, which CALL and friends don't have.
+    x64Ins ins = p[i];
+    if(ins.params[0].type & REL8 && ins.op - 1u < sizeof(x64Table) / sizeof(x64LookupGeneralIns) && !has_rel_form(ins.op, 0, REL8))
+      ins.params[0].type = REL32;
+
+    const x64LookupActualIns* res = identify(&ins);
+    if(!res) return i;
+
+    u32 param = 0, size = 0;
+    i64 target = -1;
+    if(res->rel_oper && ins.params[res->rel_oper - 1].type & X64_ABS_REF)
+      return error(ASMERR_REL_OUT_OF_RANGE, "relptr() can't be streamed, on ins '%s'", x64stringify(p + i, 1)), i;
+    if(res->rel_oper && !(ins.params[res->rel_oper - 1].type & X64_HOLE)) {
+      param = res->rel_oper - 1;
+      target = (i64) s->num + (i32) ins.params[param].value;
+
+      // Backwards, so the distance is known and the smallest form that fits it can be picked.
+      if(target >= 0 && target <= s->num) {
+        x64Ins shorter = ins;
+        shorter.params[param] = (x64Operand) { REL8, 0 };
+        const x64LookupActualIns* short_res = has_rel_form(ins.op, param, REL8) ? identify(&shorter) : NULL;
+        u32 short_len = short_res ? encode(&shorter, short_res, s->code + s->len) : 0;
+        if(short_len && (i64) s->offsets[target] - (s->len + short_len) >= -128) {
+          s->code[s->len + short_len - 1] = s->offsets[target] - (s->len + short_len);
+          s->num ++, s->len += short_len;
+          continue;
+        }
+
+        ins.params[param] = (x64Operand) { REL32, 0 };
+        if(!(res = identify(&ins))) return error(ASMERR_REL_OUT_OF_RANGE, "Relative reference out of range on ins '%s'", x64stringify(p + i, 1)), i;
+      }
+
+      // Forwards, it isn't known how far yet, so it gets a rel32 unless the instruction only has a rel8, like LOOP.
+      else if(has_rel_form(ins.op, param, REL32)) {
+        ins.params[param] = (x64Operand) { REL32, 0 };
+        if(!(res = identify(&ins))) return i;
+      }
+      ins.params[param].value = 0;
+      size = res->args[param] == REL8 ? 1 : 4;
+    }
+    else if(res->mem_oper && ins.params[res->mem_oper - 1].value & 0x4000000000000000) {
+      param = res->mem_oper - 1;
+      target = (i64) s->num + (i32) ins.params[param].value;
+      ins.params[param].value &= ~(u64) 0xffffffff;
+      size = 4;
+    }
+
+    if(size && target < 0)
+      return error(ASMERR_REL_OUT_OF_RANGE, "Relative reference out of range on ins '%s'", x64stringify(p + i, 1)), i;
+
+    u32 len = encode(&ins, res, s->code + s->len);
+    if(!len) return i;
+    const u32 end = s->len + len;
+
+    if(size) {
+      const u32 at = end - (res->rel_oper ? size : trailer_size(res) + 4);
+      if(target <= s->num) link_disp(s->code + at, (i64) s->offsets[target] - end, size);
+      else if(target > s->num + 1) { // Right after this one is a displacement of 0, which is what's already there.
+        if(!grow((void**) &s->fixups, &s->fixupscap, s->numfixups + 1, sizeof(struct x64Fixup)))
+          return error(ASMERR_OUT_OF_MEMORY, "Out of memory growing the stream."), i;
+        s->fixups[s->numfixups ++] = (struct x64Fixup) { target, at, end, size };
+        if(target < s->nexttarget) s->nexttarget = target;
+      }
+    }
+
+    s->num ++, s->len = end;
+  }
+  return num;
+}
+
+u8* x64stream_finish(x64Stream* s, u32* len) {
+  u8* code = s->code;
+  *len = s->len;
+
+  // References to right after the last instruction are fine, anything further never got pushed.
+  if(s->failed || (s->nexttarget == s->num && !resolve_fixups(s, s->num, s->len))) goto error;
+  if(s->numfixups) {
+    error(ASMERR_REL_OUT_OF_RANGE, "Relative reference to instruction %u, past the last one pushed.", s->nexttarget);
+    goto error;
+  }
+
+  ASM_X64_FREE(s->offsets);
+  ASM_X64_FREE(s->fixups);
+  ASM_X64_FREE(s);
+  return code;
+error:
+  ASM_X64_FREE(s->code);
+  ASM_X64_FREE(s->offsets);
+  ASM_X64_FREE(s->fixups);
+  ASM_X64_FREE(s);
+  *len = 0;
+  return NULL;
+}
+
+// ------------------------------------ Executable Memory ------------------------------------ //
+
+#define X64_HUGE_PAGE 0x200000
+
+#if defined _WIN32 || defined __CYGWIN__
+
+// https://learn.microsoft.com/en-us/windows/win32/memory/memory-protection-constants
+#define PAGE_EXECUTE_READ 0x20
+#define PAGE_EXECUTE_READWRITE 0x40
+// https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-virtualalloc
+#define MEM_COMMIT 0x00001000
+#define MEM_RESERVE 0x00002000
+#define MEM_LARGE_PAGES 0x20000000
+// https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-virtualfree
+#define MEM_RELEASE 0x8000
+#define MEM_DECOMMIT 0x4000
+
+__attribute((dllimport)) void* __attribute((stdcall)) VirtualAlloc(void* lpAddress, size_t dwSize, u32 flAllocationType, u32 flProtect);
+__attribute((dllimport)) int __attribute((stdcall)) VirtualProtect(void* lpAddress, size_t dwSize, u32 flNewProtect, u32* lpflOldProtect);
+__attribute((dllimport)) int __attribute((stdcall)) VirtualFree(void* lpAddress, size_t dwSize, u32 dwFreeType);
+
+static inline u32 page_size(void) { return 4096; }
+
+// Large pages need the "Lock pages in memory" privilege, so they're tried first and fall back to normal pages.
+static u8* exec_map(u32 size, u8** rw, bool huge) {
+  *rw = NULL;
+  u8* p = huge ? VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_EXECUTE_READ) : NULL;
+  return p ? p : VirtualAlloc(NULL, size, MEM_COMMIT, PAGE_EXECUTE_READ);
+}
+
+static void exec_unmap(u8* p, u32 size, u8* rw) {
+  VirtualFree(p, 0, MEM_RELEASE);
+  (void)size, (void)rw;
+}
+
+// Gives back the pages from `p` to `p + size` at the end of a mapping, which is only released as a whole.
+static void exec_trim(u8* p, u32 size, u8* rw) {
+  VirtualFree(p, size, MEM_DECOMMIT);
+  (void)rw;
+}
+
+static bool exec_protect(u8* p, u32 size, bool writable) {
+  u32 old;
+  return VirtualProtect(p, size, writable ? PAGE_EXECUTE_READWRITE : PAGE_EXECUTE_READ, &old);
+}
+
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#if defined __linux__ && !defined ASM_X64_NO_DUAL_MAP
+#include <sys/syscall.h>
+#define X64_DUAL_MAP
+#endif
+#ifndef MADV_HUGEPAGE
+#define MADV_HUGEPAGE 14
+#endif
+
+static inline u32 page_size(void) { return sysconf(_SC_PAGESIZE); }
+
+// Where the next mapping is asked for: just below the code of the program, working down, so relptr()s to its functions can be
+// called directly instead of through a veneer. The kernel puts it somewhere else if it's taken. Only used with the heap locked.
+static uintptr_t exec_next = 1;
+
+// Huge pages only back memory lined up with them, so huge mappings are made inside a reservation a huge page bigger than them.
+static void* exec_mmap(u32 size, int flags, int fd, bool huge) {
+  if(exec_next == 1) {
+    const uintptr_t code = (uintptr_t) exec_mmap & -(uintptr_t) 0x100000;
+    exec_next = code > 0x2000000 ? code - 0x1000000 : 0;
+  }
+  const u32 span = huge ? size + X64_HUGE_PAGE : size;
+  void *const hint = exec_next > span ? (void*) (exec_next - span) : NULL;
+  if(!huge) {
+    void *const p = mmap(hint, size, PROT_READ | PROT_EXEC, flags, fd, 0);
+    if(hint && p == hint) exec_next = (uintptr_t) p;
+    return p;
+  }
+
+  u8 *const r = mmap(hint, span, PROT_NONE, MAP_PRIVATE | MAP_ANON | MAP_NORESERVE, -1, 0);
+  if(r == MAP_FAILED) return MAP_FAILED;
+  if(hint && r == hint) exec_next = (uintptr_t) r;
+  u8 *const p = (u8*) (((uintptr_t) r + X64_HUGE_PAGE - 1) & -(uintptr_t) X64_HUGE_PAGE);
+  if(mmap(p, size, PROT_READ | PROT_EXEC, flags | MAP_FIXED, fd, 0) == MAP_FAILED) return munmap(r, span), MAP_FAILED;
+  if(p > r) munmap(r, p - r);
+  if(r + span > p + size) munmap(p + size, r + span - (p + size));
+  madvise(p, size, MADV_HUGEPAGE); // Transparent huge pages, if they aren't already from hugetlbfs
+  return p;
+}
+
+// Maps `size` bytes of executable memory. On Linux it's a memfd mapped twice, once only executable and once only writable at
+// `*rw`, so code is never writable and executable at the same address. Falls back to 1 mapping with `*rw` as NULL if the
+// kernel doesn't allow it. `huge` memory comes from hugetlbfs if it has pages reserved, and is left to transparent huge pages
+// otherwise, which only back a memfd if they're enabled for shared memory.
+static u8* exec_map(u32 size, u8** rw, bool huge) {
+#ifdef X64_DUAL_MAP
+  for(int hugetlb = huge; hugetlb >= 0; hugetlb --) {
+    const int fd = syscall(SYS_memfd_create, "chasm", hugetlb ? 1 | 4 /* MFD_CLOEXEC | MFD_HUGETLB */ : 1);
+    if(fd < 0) continue;
+    void *x = MAP_FAILED, *w = MAP_FAILED;
+    if(!ftruncate(fd, size)) {
+      x = exec_mmap(size, MAP_SHARED, fd, huge);
+      w = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd); // The mappings keep the memory alive
+    if(x != MAP_FAILED && w != MAP_FAILED) return *rw = w, x;
+    if(x != MAP_FAILED) munmap(x, size);
+    if(w != MAP_FAILED) munmap(w, size);
+  }
+#endif
+  *rw = NULL;
+  void* p = exec_mmap(size, MAP_PRIVATE | MAP_ANON, -1, huge);
+  return p == MAP_FAILED ? NULL : p;
+}
+
+static void exec_unmap(u8* p, u32 size, u8* rw) {
+  munmap(p, size);
+  if(rw) munmap(rw, size);
+}
+
+// Gives back the pages from `p` to `p + size` at the end of a mapping.
+static void exec_trim(u8* p, u32 size, u8* rw) {
+  exec_unmap(p, size, rw);
+}
+
+static bool exec_protect(u8* p, u32 size, bool writable) {
+  u8 *const page = (u8*) ((uintptr_t) p & -(uintptr_t) page_size());
+  return !mprotect(page, p + size - page, writable ? PROT_READ | PROT_WRITE | PROT_EXEC : PROT_READ | PROT_EXEC);
+}
+
+#endif
+
+// Aligns to the next multiple of a, where a is a power of 2
+static inline u32 align_up(u32 n, u32 a) { return (n + a - 1) & ~(a - 1); }
+
+// Code from x64exec() is cut out of big regions in size classes 16 bytes apart, so every function starts 16 byte aligned, and
+// freed code is kept in a list for its class to be reused instead of being given back, with x64exec_hot() code in lists of its
+// own. Anything bigger than the biggest class gets pages of its own. Regions of huge pages are a huge page big.
+#define X64_EXEC_REGION 0x100000
+#define X64_EXEC_GRAIN 16
+#define X64_EXEC_CLASSES 256
+
+static struct x64ExecHeap {
+  struct x64ExecArena { u8* at; u32 left; } arenas[2]; // What's left of the regions being cut up, for x64exec() and x64exec_hot()
+  struct x64ExecFree { u8** blocks; u32 len, cap; } free[2][X64_EXEC_CLASSES]; // For x64exec() and x64exec_hot()
+  struct x64ExecSpan { u8 *start, *end; }* spans; u32 spanslen, spanscap; // Pages left writable since x64exec_begin()
+  struct x64ExecMap { u8 *rx, *rw; u32 size; bool region, huge, hot; }* maps; u32 mapslen, mapscap; // Every mapping, sorted by rx
+  u32 modes; // From x64exec_mode()
+  bool batching;
+  bool lock;
+} heap;
+
+static inline void heap_lock(void) {
+  while(__atomic_test_and_set(&heap.lock, __ATOMIC_ACQUIRE));
+}
+
+static inline void heap_unlock(void) {
+  __atomic_clear(&heap.lock, __ATOMIC_RELEASE);
+}
+
+static inline u32 size_class(u32 size) {
+  return size > X64_EXEC_GRAIN ? (size + X64_EXEC_GRAIN - 1) / X64_EXEC_GRAIN : 1;
+}
+
+// Index of the first mapping starting after `p`, so the one before it is the only one that can hold `p`.
+static u32 heap_after(const u8* p) {
+  u32 lo = 0, hi = heap.mapslen;
+  while(lo < hi) {
+    const u32 mid = (lo + hi) / 2;
+    if(heap.maps[mid].rx <= p) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+// The mapping `p` is in, or NULL if it isn't from x64exec().
+static struct x64ExecMap* heap_find(const u8* p) {
+  const u32 i = heap_after(p);
+  return i && p < heap.maps[i - 1].rx + heap.maps[i - 1].size ? heap.maps + i - 1 : NULL;
+}
+
+// exec_map(), remembering the mapping and its writable view if it got one.
+static u8* heap_map(u32 size, bool region, bool huge, bool hot) {
+  u8* rw;
+  u8 *const rx = exec_map(size, &rw, huge);
+  if(!rx) return NULL;
+  if(!grow((void**) &heap.maps, &heap.mapscap, heap.mapslen + 1, sizeof(struct x64ExecMap)))
+    return exec_unmap(rx, size, rw), NULL;
+
+  const u32 i = heap_after(rx);
+  memmove(heap.maps + i + 1, heap.maps + i, (heap.mapslen - i) * sizeof(struct x64ExecMap));
+  heap.maps[i] = (struct x64ExecMap) { rx, rw, size, region, huge, hot };
+  heap.mapslen ++;
+  return rx;
+}
+
+static void heap_unmap(struct x64ExecMap* m) {
+  exec_unmap(m->rx, m->size, m->rw);
+  memmove(m, m + 1, (heap.maps + -- heap.mapslen - m) * sizeof(struct x64ExecMap));
+}
+
+// The pages the code at `p` to `p + size` is on. Huge pages are only ever protected all at once, since changing the protection
+// of part of one splits it up into normal pages.
+static void exec_pages(const struct x64ExecMap* m, u8* p, u32 size, u8** start, u8** end) {
+  const uintptr_t mask = -(uintptr_t) page_size();
+  if(m && m->huge) *start = m->rx, *end = m->rx + m->size;
+  else *start = (u8*) ((uintptr_t) p & mask), *end = (u8*) ((uintptr_t) (p + size + ~mask) & mask);
+}
+
+// Where to write the code at `p` to `p + size`. Dual mapped code is written through its writable view, and anything else has its
+// pages made writable without ever taking the execute bit away from threads running them. Between x64exec_begin() and
+// x64exec_end(), pages already made writable are left alone.
+static u8* exec_writable(u8* p, u32 size) {
+  const struct x64ExecMap *const m = heap_find(p);
+  if(m && m->rw) return m->rw + (p - m->rx);
+
+  u8 *start, *end;
+  exec_pages(m, p, size, &start, &end);
+  if(!heap.batching) return exec_protect(start, end - start, true) ? p : NULL;
+
+  struct x64ExecSpan *const last = heap.spanslen ? heap.spans + heap.spanslen - 1 : NULL;
+  if(last && start >= last->start && end <= last->end) return p;
+  if(last && start >= last->start && start <= last->end) {
+    if(!exec_protect(last->end, end - last->end, true)) return NULL;
+    last->end = end;
+    return p;
+  }
+
+  if(!grow((void**) &heap.spans, &heap.spanscap, heap.spanslen + 1, sizeof(struct x64ExecSpan))) return NULL;
+  if(!exec_protect(start, end - start, true)) return NULL;
+  heap.spans[heap.spanslen ++] = (struct x64ExecSpan) { start, end };
+  return p;
+}
+
+// Makes the pages only executable again after writing through `w`, unless it was a writable view or x64exec_begin() is
+// leaving them writable.
+static void exec_done(u8* p, u8* w, u32 size) {
+  if(w != p || heap.batching) return;
+  u8 *start, *end;
+  exec_pages(heap_find(p), p, size, &start, &end);
+  exec_protect(start, end - start, false);
+}
+
+static inline void heap_free(u8* p, u32 class, bool hot) {
+  struct x64ExecFree *const f = heap.free[hot] + class - 1;
+  if(grow((void**) &f->blocks, &f->cap, f->len + 1, sizeof(u8*))) f->blocks[f->len ++] = p;
+}
+
+// Gives `size` bytes of code back. Code with a mapping of its own is unmapped whatever `size` is, since x64as_exec() can trim
+// it down to a size that looks like a class. Blocks of a region bigger than the biggest class, which x64as_exec() can leave, go
+// back in pieces of the biggest class. Hot code goes back to the hot lists, so x64exec() never gets it.
+static void heap_release(u8* p, u32 size) {
+  struct x64ExecMap *const m = heap_find(p);
+  if(!m) return;
+  if(!m->region && m->rx == p) return heap_unmap(m);
+
+  u32 class = size_class(size);
+  for(; class > X64_EXEC_CLASSES; class -= X64_EXEC_CLASSES, p += X64_EXEC_CLASSES * X64_EXEC_GRAIN) heap_free(p, X64_EXEC_CLASSES, m->hot);
+  heap_free(p, class, m->hot);
+}
+
+// Cuts `size` bytes, a multiple of the grain, off of the region of x64exec() or x64exec_hot(), mapping a new one when it runs
+// out. Hot code always gets huge pages, and the rest only with X64_EXEC_HUGE_PAGES.
+static u8* heap_cut(u32 size, bool hot) {
+  struct x64ExecArena *const a = heap.arenas + hot;
+  if(a->left < size) {
+    const bool huge = hot || heap.modes & X64_EXEC_HUGE_PAGES;
+    const u32 regionsize = huge ? X64_HUGE_PAGE : X64_EXEC_REGION;
+    u8 *const region = heap_map(regionsize, true, huge, hot);
+    if(!region) return NULL;
+    if(a->left) heap_release(a->at, a->left); // The end of the last region isn't wasted
+    a->at = region, a->left = regionsize;
+  }
+  u8 *const p = a->at;
+  a->at += size, a->left -= size;
+  return p;
+}
+
+// Hot code is packed together in its own regions, only reusing freed hot code, so it's on as few huge pages as it can be. With
+// huge pages, code bigger than the biggest class is cut out of a region too, unless it's too big for one, instead of wasting
+// most of a huge page of its own.
+static u8* heap_alloc(u32 size, bool hot) {
+  const u32 class = size_class(size);
+  const bool huge = hot || heap.modes & X64_EXEC_HUGE_PAGES;
+  if(class <= X64_EXEC_CLASSES && heap.free[hot][class - 1].len) return heap.free[hot][class - 1].blocks[-- heap.free[hot][class - 1].len];
+  if(class <= X64_EXEC_CLASSES || (huge && size <= X64_HUGE_PAGE / 8)) return heap_cut(class * X64_EXEC_GRAIN, hot);
+  return heap_map(align_up(size, huge ? X64_HUGE_PAGE : page_size()), false, huge, hot);
+}
+
+static void (*load(void* mem, u32 size, bool hot))() {
+  heap_lock();
+  u8 *const buf = heap_alloc(size, hot);
+  if(!buf) {
+    heap_unlock();
+    return error(ASMERR_OUT_OF_MEMORY, "Out of memory mapping %u bytes of code.", size), NULL;
+  }
+
+  u8 *const w = exec_writable(buf, size);
+  if(!w) {
+    heap_release(buf, size);
+    heap_unlock();
+    return error(ASMERR_OUT_OF_MEMORY, "Couldn't make %u bytes of code writable.", size), NULL;
+  }
+  memcpy(w, mem, size);
+  exec_done(buf, w, size);
+  heap_unlock();
+  return (void (*)()) buf;
+}
+
+void (*x64exec(void* mem, u32 size))() {
+  return load(mem, size, false);
+}
+
+void (*x64exec_hot(void* mem, u32 size))() {
+  return load(mem, size, true);
+}
+
+void x64exec_free(void* buf, u32 size) {
+  heap_lock();
+  heap_release(buf, size);
+  heap_unlock();
+}
+
+// The most x64as() can make out of `num` instructions: 15 bytes for every instruction, the padding of every align(), the size of
+// every constant, a veneer for every relptr() and 31 bytes to align the pool.
+static u32 worst_size(const x64 p, u32 num) {
+  u64 size = (u64) num * 15 + 31;
+  for(u32 i = 0; i < num; i ++) {
+    if(p[i].op == X64_ALIGN) size += p[i].params[0].value;
+    for(u32 j = 0; j < 4 && p[i].params[j].type; j ++) {
+      const u64 type = p[i].params[j].type;
+      if(p[i].op == X64_CONST) size += type & IMM64 ? 8 : type & IMM32 ? 4 : type & IMM16 ? 2 : 1;
+      else if(type & X64_ABS_REF) size += X64_VENEER_SIZE;
+    }
+  }
+  return size < UINT32_MAX / 2 ? size : UINT32_MAX / 2;
+}
+
+// Reserves room for x64as_exec() to assemble into. Anything that isn't too big for it comes out of the region, so what's left
+// over can be given back by heap_shrink().
+static u8* heap_reserve(u32 size) {
+  if(size_class(size) <= X64_EXEC_CLASSES || size > X64_EXEC_REGION / 8) return heap_alloc(size, false);
+  return heap_cut(align_up(size, X64_EXEC_GRAIN), false);
+}
+
+// Gives back everything after the first `size` bytes of the `reserved` from heap_reserve(). Code with pages of its own loses the
+// pages it doesn't need, and code in a region gives the rest back to the region, or to the free lists if more was cut since.
+static void heap_shrink(u8* p, u32 reserved, u32 size) {
+  struct x64ExecMap *const m = heap_find(p);
+  if(!m->region && m->rx == p && size_class(reserved) > X64_EXEC_CLASSES) {
+    const u32 keep = align_up(size, m->huge ? X64_HUGE_PAGE : page_size());
+    if(keep < m->size) exec_trim(p + keep, m->size - keep, m->rw ? m->rw + keep : NULL), m->size = keep;
+    return;
+  }
+
+  const u32 had = size_class(reserved) * X64_EXEC_GRAIN, has = size_class(size) * X64_EXEC_GRAIN;
+  if(had == has) return;
+  struct x64ExecArena *const a = heap.arenas;
+  if(p + had == a->at) a->at -= had - has, a->left += had - has;
+  else heap_release(p + has, had - has);
+}
+
+void (*x64as_exec(const x64 p, u32 num, u32* len))() {
+  *len = 0;
+  for(u32 cap = worst_size(p, num);; cap *= 2) {
+    heap_lock();
+    u8 *const buf = heap_reserve(cap);
+    const struct x64ExecMap *const m = buf ? heap_find(buf) : NULL;
+    u8 *const w = m && m->rw ? m->rw + (buf - m->rx) : NULL;
+    heap_unlock();
+    if(!buf) return error(ASMERR_OUT_OF_MEMORY, "Out of memory mapping %u bytes of code.", cap), NULL;
+
+    // Code is assembled straight into its writable view, or next to it to be copied there when it doesn't have one.
+    u8* dest = w;
+    if(!dest && !grow((void**) &scratch.exec, &scratch.execcap, cap, 1)) {
+      x64exec_free(buf, cap);
+      return error(ASMERR_OUT_OF_MEMORY, "Out of memory assembling %u instructions.", num), NULL;
+    }
+    if(!dest) dest = scratch.exec;
+    const u32 size = x64as_at(p, num, dest, cap, (u64) buf);
+
+    heap_lock();
+    if(!size) {
+      heap_release(buf, cap);
+      heap_unlock();
+      // Code can be just past the worst case if it's padded for X64_MODE_JCC_ERRATUM or patch points.
+      if(cur_error.error_type == ASMERR_BUFFER_TOO_SMALL && cap < UINT32_MAX / 2) {
+        cur_error.error = false;
+        continue;
+      }
+      return NULL;
+    }
+
+    if(!w) {
+      u8 *const to = exec_writable(buf, size);
+      if(!to) {
+        heap_release(buf, cap);
+        heap_unlock();
+        return error(ASMERR_OUT_OF_MEMORY, "Couldn't make %u bytes of code writable.", size), NULL;
+      }
+      memcpy(to, dest, size);
+      exec_done(buf, to, size);
+    }
+    heap_shrink(buf, cap, size);
+    heap_unlock();
+
+    *len = size;
+    return (void (*)()) buf;
+  }
+}
+
+void x64exec_mode(u32 modes) {
+  heap_lock();
+  heap.modes = modes;
+  heap_unlock();
+}
+
+void x64exec_begin(void) {
+  heap_lock();
+  heap.batching = true;
+  heap_unlock();
+}
+
+void x64exec_end(void) {
+  heap_lock();
+  for(u32 i = 0; i < heap.spanslen; i ++) exec_protect(heap.spans[i].start, heap.spans[i].end - heap.spans[i].start, false);
+  heap.spanslen = 0;
+  heap.batching = false;
+  heap_unlock();
+}
+
+// Stores to code that's being run, through its writable view or by only ever adding the write bit to it so other threads can
+// keep running it.
+static bool patch_store(u64* word, u64 value) {
+  heap_lock();
+  u64 *const w = (u64*) exec_writable((u8*) word, 8);
+  if(!w) {
+    heap_unlock();
+    return error(ASMERR_INVALID_PATCH, "Couldn't make the code at %p writable to patch it.", (void*) word);
+  }
+  __atomic_store_n(w, value, __ATOMIC_SEQ_CST);
+  exec_done((u8*) word, (u8*) w, 8);
+  heap_unlock();
+  return true;
+}
+
+// Patches the `size` bytes at `site` by storing the whole aligned 8 byte word they're in at once, so threads running the code
+// only ever see all of the old bytes or all of the new ones.
+static bool patch(u8* site, const void* bytes, u32 size) {
+  u64 *const word = (u64*) ((uintptr_t) site & ~(uintptr_t) 7);
+  const u32 at = site - (u8*) word;
+  if(at + size > 8)
+    return error(ASMERR_INVALID_PATCH, "The %u bytes at %p straddle 2 words, so they can't be patched atomically.", size, (void*) site);
+
+  u64 value = __atomic_load_n(word, __ATOMIC_RELAXED);
+  memcpy((u8*) &value + at, bytes, size);
+  return patch_store(word, value);
+}
+
+bool x64patch_rel(void* site, const void* target) {
+  const i64 disp = (const u8*) target - ((u8*) site + 4);
+  if(disp != (i32) disp)
+    return error(ASMERR_REL_OUT_OF_RANGE, "%p is out of the 2 GB a rel32 at %p reaches.", target, site);
+
+  const i32 rel = disp;
+  return patch(site, &rel, 4);
+}
+
+bool x64patch_imm(void* site, i64 value, u32 size) {
+  if(size != 4 && size != 8) return error(ASMERR_INVALID_PATCH, "Immediates are patched as 4 or 8 bytes, not %u.", size);
+  return patch(site, &value, size);
+}
+
+// ------------------------------------ Code Cache ------------------------------------ //
+
+// Code from x64cache() by what it was assembled from, so the same instructions are only ever assembled and mapped once. Entries
+// are chained into 2 hash tables, by the hash of their instructions and by their code, and stay after their last release until
+// x64cache_flush().
+static struct x64Cache {
+  struct x64CacheEntry {
+    x64Ins* ins; u32 num, modes; // What the code was assembled from, normalized, and the x64as_mode() it was assembled with
+    u64 hash;
+    u8* code; u32 len, refs;
+    u32 next, nextcode; // The next entry in the same bucket of each table, or UINT32_MAX
+    bool shared; // Code with patch points is only in the table by code, so it's never handed out twice
+  }* entries; u32 entrieslen, entriescap;
+  u32 free; // Flushed entries to reuse, chained through `next`
+  u32 *byhash, *bycode; u32 mask; // Buckets of both tables, in 1 allocation
+  u32 count; // Entries in the tables
+  bool lock;
+} cache = { .free = UINT32_MAX };
+
+static inline void cache_lock(void) {
+  while(__atomic_test_and_set(&cache.lock, __ATOMIC_ACQUIRE));
+}
+
+static inline void cache_unlock(void) {
+  __atomic_clear(&cache.lock, __ATOMIC_RELEASE);
+}
+
+static inline u64 mix(u64 h, u64 x) {
+  return ((h << 5 | h >> 59) ^ x) * 0x9E3779B97F4A7C15;
+}
+
+static inline u32 code_bucket(const void* code) {
+  return mix(0, (uintptr_t) code) >> 32 & cache.mask;
+}
+
+// Copies `p` to scratch.norm with its labels numbered in the order they first show up and its unused operands zeroed, so code
+// that only differs in the ids of its labels is the same, and hashes it. Relative references are already by instruction, so
+// they're the same wherever the code ends up. Sets `patched` if there's a patch point in it.
+static x64Ins* normalize(const x64 p, u32 num, u64* hash, bool* patched) {
+  if(!grow((void**) &scratch.norm, &scratch.normcap, num, sizeof(x64Ins))) goto oom;
+  x64Ins *const n = scratch.norm;
+  u32 labelslen = 0, labels = 0;
+  u64 h = mix(as_modes, num);
+  *patched = false;
+
+  for(u32 i = 0; i < num; i ++) {
+    n[i] = (x64Ins) { .op = p[i].op };
+    *patched |= p[i].op == X64_PATCH;
+    h = mix(h, p[i].op);
+
+    for(u32 j = 0; j < 4 && p[i].params[j].type; j ++) {
+      n[i].params[j] = p[i].params[j];
+      if(p[i].params[j].type & X64_LABEL_REF) {
+        const u32 id = p[i].params[j].value;
+        if(p[i].params[j].value > X64_MAX_LABEL)
+          return error(ASMERR_INVALID_LABEL, "Label %llu on instruction %u is past X64_MAX_LABEL.", (unsigned long long) p[i].params[j].value, i), NULL;
+        if(id >= labelslen) {
+          if(!grow((void**) &scratch.labels, &scratch.labelscap, id + 1, sizeof(u32))) goto oom;
+          memset(scratch.labels + labelslen, 0xff, (id + 1 - labelslen) * sizeof(u32));
+          labelslen = id + 1;
+        }
+        if(scratch.labels[id] == UINT32_MAX) scratch.labels[id] = labels ++;
+        n[i].params[j].value = scratch.labels[id];
+      }
+      h = mix(mix(h, n[i].params[j].type), n[i].params[j].value);
+    }
+  }
+
+  *hash = h;
+  return n;
+
+oom:
+  return error(ASMERR_OUT_OF_MEMORY, "Out of memory hashing %u instructions.", num), NULL;
+}
+
+static bool same_code(const struct x64CacheEntry* e, const x64Ins* n, u32 num, u64 hash) {
+  if(e->hash != hash || e->num != num || e->modes != as_modes) return false;
+  for(u32 i = 0; i < num; i ++) {
+    if(e->ins[i].op != n[i].op) return false;
+    for(u32 j = 0; j < 4; j ++)
+      if(e->ins[i].params[j].type != n[i].params[j].type || e->ins[i].params[j].value != n[i].params[j].value) return false;
+  }
+  return true;
+}
+
+static u32 cache_find(const x64Ins* n, u32 num, u64 hash) {
+  u32 i = cache.byhash ? cache.byhash[hash >> 32 & cache.mask] : UINT32_MAX;
+  while(i != UINT32_MAX && !same_code(cache.entries + i, n, num, hash)) i = cache.entries[i].next;
+  return i;
+}
+
+static void cache_link(u32 i) {
+  struct x64CacheEntry *const e = cache.entries + i;
+  if(e->shared) {
+    u32 *const bucket = cache.byhash + (e->hash >> 32 & cache.mask);
+    e->next = *bucket, *bucket = i;
+  }
+  u32 *const bucket = cache.bycode + code_bucket(e->code);
+  e->nextcode = *bucket, *bucket = i;
+}
+
+static void cache_unlink(u32 i) {
+  struct x64CacheEntry *const e = cache.entries + i;
+  u32* at;
+  if(e->shared) {
+    for(at = cache.byhash + (e->hash >> 32 & cache.mask); *at != i; at = &cache.entries[*at].next);
+    *at = e->next;
+  }
+  for(at = cache.bycode + code_bucket(e->code); *at != i; at = &cache.entries[*at].nextcode);
+  *at = e->nextcode;
+
+  x64exec_free(e->code, e->len);
+  ASM_X64_FREE(e->ins);
+  e->code = NULL;
+  e->next = cache.free, cache.free = i;
+  cache.count --;
+}
+
+// Makes room for 1 more entry, doubling the tables when they're 3/4 full.
+static u32 cache_entry(void) {
+  if(!cache.byhash || cache.count + 1 > (cache.mask + 1) / 4 * 3) {
+    const u32 mask = cache.byhash ? cache.mask * 2 + 1 : 63;
+    u32 *const tables = ASM_X64_MALLOC((mask + 1) * 2 * sizeof(u32));
+    if(!tables) return UINT32_MAX;
+    ASM_X64_FREE(cache.byhash);
+    memset(tables, 0xff, (mask + 1) * 2 * sizeof(u32));
+    cache.byhash = tables, cache.bycode = tables + mask + 1, cache.mask = mask;
+    for(u32 i = 0; i < cache.entrieslen; i ++) if(cache.entries[i].code) cache_link(i);
+  }
+
+  if(cache.free != UINT32_MAX) {
+    const u32 i = cache.free;
+    cache.free = cache.entries[i].next;
+    return i;
+  }
+  if(!grow((void**) &cache.entries, &cache.entriescap, cache.entrieslen + 1, sizeof(struct x64CacheEntry))) return UINT32_MAX;
+  return cache.entrieslen ++;
+}
+
+void (*x64cache(const x64 p, u32 num, u32* len))() {
+  *len = 0;
+  u64 hash;
+  bool patched;
+  const x64Ins *const n = normalize(p, num, &hash, &patched);
+  if(!n) return NULL;
+
+  if(!patched) {
+    cache_lock();
+    const u32 i = cache_find(n, num, hash);
+    if(i != UINT32_MAX) {
+      struct x64CacheEntry *const e = cache.entries + i;
+      e->refs ++;
+      *len = e->len;
+      u8 *const code = e->code;
+      cache_unlock();
+      return (void (*)()) code;
+    }
+    cache_unlock();
+  }
+
+  // Assembled without the lock, so another thread can put the same code in first, which is used instead.
+  u32 size;
+  u8 *const code = (u8*) x64as_exec(n, num, &size);
+  if(!code) return NULL;
+  x64Ins *const ins = patched ? NULL : ASM_X64_MALLOC(num * sizeof(x64Ins));
+  if(!patched && !ins) {
+    x64exec_free(code, size);
+    return error(ASMERR_OUT_OF_MEMORY, "Out of memory caching %u instructions.", num), NULL;
+  }
+  if(ins) memcpy(ins, n, num * sizeof(x64Ins));
+
+  cache_lock();
+  u32 i = patched ? UINT32_MAX : cache_find(ins, num, hash);
+  if(i != UINT32_MAX) {
+    struct x64CacheEntry *const e = cache.entries + i;
+    e->refs ++;
+    *len = e->len;
+    u8 *const theirs = e->code;
+    cache_unlock();
+    x64exec_free(code, size);
+    ASM_X64_FREE(ins);
+    return (void (*)()) theirs;
+  }
+
+  if((i = cache_entry()) == UINT32_MAX) {
+    cache_unlock();
+    x64exec_free(code, size);
+    ASM_X64_FREE(ins);
+    return error(ASMERR_OUT_OF_MEMORY, "Out of memory caching %u instructions.", num), NULL;
+  }
+  cache.entries[i] = (struct x64CacheEntry) { ins, num, as_modes, hash, code, size, 1, UINT32_MAX, UINT32_MAX, !patched };
+  cache_link(i);
+  cache.count ++;
+  cache_unlock();
+
+  *len = size;
+  return (void (*)()) code;
+}
+
+void x64cache_release(void* code) {
+  cache_lock();
+  for(u32 i = cache.byhash ? cache.bycode[code_bucket(code)] : UINT32_MAX; i != UINT32_MAX; i = cache.entries[i].nextcode) {
+    struct x64CacheEntry *const e = cache.entries + i;
+    if(e->code != code) continue;
+    if(!-- e->refs && !e->shared) cache_unlink(i);
+    break;
+  }
+  cache_unlock();
+}
+
+void x64cache_flush(void) {
+  cache_lock();
+  for(u32 i = 0; i < cache.entrieslen; i ++)
+    if(cache.entries[i].code && !cache.entries[i].refs) cache_unlink(i);
+  cache_unlock();
+}
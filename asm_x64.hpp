@@ -0,0 +1,2579 @@
+/*
+ * asm_x64.hpp v1.1.0 - Aqil Contractor @aqilc 2025
+ * Dual Licenced under MIT and Public Domain.
+ *
+ * Compile time encoding for the "chasm" library in C++20, for code that never changes like prologues and trampolines.
+ * Mismatched arguments and other assembler errors are compile errors here. Does not need asm_x64.c.
+ *
+ * constexpr std::array prologue { x64Ins(PUSH, rbp), x64Ins(MOV, rbp, rsp) };
+ * constexpr auto bytes = chasm::x64as<prologue>(); // std::array<uint8_t, 4>
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "asm_x64.h"
+
+namespace chasm {
+
+// Same as x64LookupActualIns in asm_x64.c, in declaration order.
+struct x64Form {
+	uint8_t mem_oper, reg_oper, rel_oper, vex_oper, imm_oper, is4_oper;
+	uint8_t rex, oplen, preflen, vex, vex_byte, modrm;
+	bool modrmreq, modrmreg, preffered;
+	uint8_t arglen;
+	uint32_t opcode, prefixes;
+	uint64_t args[4];
+};
+
+// Generated from x64Table in asm_x64.c by tools/hpp_table.c, regenerate it along with the table. `hpp_table --check asm_x64.hpp`
+// fails if the two have drifted apart.
+inline constexpr x64Form forms[] = {
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x14, 0x0, { 0x4000000, 0x2 } }, // adc
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x15, 0x66, { 0x20000000, 0x4 } },
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x15, 0x0, { 0x100000000, 0x8 } },
+	{ 0, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x15, 0x0, { 0x400000000, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0x80, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0x81, 0x66, { 0x10000080, 0x4 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0x81, 0x0, { 0x80000100, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0x81, 0x0, { 0x200000200, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 1, 2, 0x83, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 1, 2, 0x83, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x10, 1, 0, 1, 2, 0x83, 0x0, { 0x200000200, 0x2 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x10, 0x0, { 0x1000040, 0x1000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x10, 0x0, { 0x1000040, 0x2000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x11, 0x66, { 0x10000080, 0x10000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x11, 0x0, { 0x80000100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x11, 0x0, { 0x200000200, 0x200000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x12, 0x0, { 0x1000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x12, 0x0, { 0x2000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x13, 0x66, { 0x10000000, 0x10000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x13, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x13, 0x0, { 0x200000000, 0x200000200 } },
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x4, 0x0, { 0x4000000, 0x2 } }, // add
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x5, 0x66, { 0x20000000, 0x4 } },
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x5, 0x0, { 0x100000000, 0x8 } },
+	{ 0, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x5, 0x0, { 0x400000000, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0x80, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0x81, 0x66, { 0x10000080, 0x4 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0x81, 0x0, { 0x80000100, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0x81, 0x0, { 0x200000200, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 1, 2, 0x83, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 1, 2, 0x83, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 0, 1, 2, 0x83, 0x0, { 0x200000200, 0x2 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x0, 0x0, { 0x1000040, 0x1000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x0, 0x0, { 0x1000040, 0x2000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x1, 0x66, { 0x10000080, 0x10000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x1, 0x0, { 0x80000100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x1, 0x0, { 0x200000200, 0x200000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2, 0x0, { 0x1000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2, 0x0, { 0x2000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3, 0x66, { 0x10000000, 0x10000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x580f, 0x66, { 0x40000000000, 0x40000000400 } }, // addpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x58, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vaddpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x58, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x580f, 0x0, { 0x40000000000, 0x40000000400 } }, // addps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 3, 0x58, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vaddps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 3, 0x58, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x580f, 0xf2, { 0x40000000000, 0x40000000200 } }, // addsd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 3, 0x58, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vaddsd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x580f, 0xf3, { 0x40000000000, 0x40000000100 } }, // addss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 3, 0x58, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vaddss
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd00f, 0x66, { 0x40000000000, 0x40000000400 } }, // addsubpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xd0, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vaddsubpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xd0, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd00f, 0xf2, { 0x40000000000, 0x40000000400 } }, // addsubps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 3, 0xd0, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vaddsubps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7f, 0x0, 1, 1, 0, 3, 0xd0, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xde380f, 0x66, { 0x40000000000, 0x40000000400 } }, // aesdec
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xde, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vaesdec
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xdf380f, 0x66, { 0x40000000000, 0x40000000400 } }, // aesdeclast
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xdf, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vaesdeclast
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xdc380f, 0x66, { 0x40000000000, 0x40000000400 } }, // aesenc
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xdc, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vaesenc
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xdd380f, 0x66, { 0x40000000000, 0x40000000400 } }, // aesenclast
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xdd, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vaesenclast
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xdb380f, 0x66, { 0x40000000000, 0x40000000400 } }, // aesimc
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0xdb, 0x0, { 0x40000000000, 0x40000000400 } }, // vaesimc
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0xdf3a0f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } }, // aeskeygenassist
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 3, 0xdf, 0x0, { 0x40000000000, 0x40000000400, 0x2 } }, // vaeskeygenassist
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x24, 0x0, { 0x4000000, 0x2 } }, // and
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x25, 0x66, { 0x20000000, 0x4 } },
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x25, 0x0, { 0x100000000, 0x8 } },
+	{ 0, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x25, 0x0, { 0x400000000, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0x80, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0x81, 0x66, { 0x10000080, 0x4 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0x81, 0x0, { 0x80000100, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0x81, 0x0, { 0x200000200, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 1, 2, 0x83, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 1, 2, 0x83, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x20, 1, 0, 1, 2, 0x83, 0x0, { 0x200000200, 0x2 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x20, 0x0, { 0x1000040, 0x1000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x20, 0x0, { 0x1000040, 0x2000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x21, 0x66, { 0x10000080, 0x10000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x21, 0x0, { 0x80000100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x21, 0x0, { 0x200000200, 0x200000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x22, 0x0, { 0x1000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x22, 0x0, { 0x2000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x23, 0x66, { 0x10000000, 0x10000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x23, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x23, 0x0, { 0x200000000, 0x200000200 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x78, 0x0, 1, 1, 0, 3, 0xf2, 0x0, { 0x80000000, 0x80000000, 0x80000100 } }, // andn
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf8, 0x0, 1, 1, 0, 3, 0xf2, 0x0, { 0x200000000, 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x540f, 0x66, { 0x40000000000, 0x40000000400 } }, // andpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x54, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vandpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x54, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x540f, 0x0, { 0x40000000000, 0x40000000400 } }, // andps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 3, 0x54, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vandps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 3, 0x54, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x550f, 0x66, { 0x40000000000, 0x40000000400 } }, // andnpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x55, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vandnpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x55, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x550f, 0x0, { 0x40000000000, 0x40000000400 } }, // andnps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 3, 0x55, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vandnps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 3, 0x55, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0xd3a0f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } }, // blendpd
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 4, 0xd, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400, 0x2 } }, // vblendpd
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 4, 0xd, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800, 0x2 } },
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0x78, 0x0, 1, 1, 0, 3, 0xf7, 0x0, { 0x80000000, 0x80000100, 0x80000000 } }, // bextr
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0xf8, 0x0, 1, 1, 0, 3, 0xf7, 0x0, { 0x200000000, 0x200000200, 0x200000000 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0xc3a0f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } }, // blendps
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 4, 0xc, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400, 0x2 } }, // vblendps
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 4, 0xc, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800, 0x2 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x15380f, 0x66, { 0x40000000000, 0x40000000400, 0x80000000000 } }, // blendvpd
+	{ 3, 1, 0, 2, 0, 4, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 4, 0x4b, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400, 0x40000000000 } }, // vblendvpd
+	{ 3, 1, 0, 2, 0, 4, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 4, 0x4b, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800, 0x100000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x14380f, 0x66, { 0x40000000000, 0x40000000400, 0x80000000000 } }, // blendvps
+	{ 3, 1, 0, 2, 0, 4, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 4, 0x4a, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400, 0x40000000000 } }, // vblendvps
+	{ 3, 1, 0, 2, 0, 4, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 4, 0x4a, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800, 0x100000000000 } },
+	{ 2, 0, 0, 1, 0, 0, 0x0, 1, 0, 0x82, 0x78, 0x18, 1, 0, 0, 2, 0xf3, 0x0, { 0x80000000, 0x80000100 } }, // blsi
+	{ 2, 0, 0, 1, 0, 0, 0x0, 1, 0, 0x82, 0xf8, 0x18, 1, 0, 0, 2, 0xf3, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 0, 0, 1, 0, 0, 0x0, 1, 0, 0x82, 0x78, 0x10, 1, 0, 0, 2, 0xf3, 0x0, { 0x80000000, 0x80000100 } }, // blsmsk
+	{ 2, 0, 0, 1, 0, 0, 0x0, 1, 0, 0x82, 0xf8, 0x10, 1, 0, 0, 2, 0xf3, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 0, 0, 1, 0, 0, 0x0, 1, 0, 0x82, 0x78, 0x8, 1, 0, 0, 2, 0xf3, 0x0, { 0x80000000, 0x80000100 } }, // blsr
+	{ 2, 0, 0, 1, 0, 0, 0x0, 1, 0, 0x82, 0xf8, 0x8, 1, 0, 0, 2, 0xf3, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xbc0f, 0x66, { 0x10000000, 0x10000080 } }, // bsf
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xbc0f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xbc0f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xbd0f, 0x66, { 0x10000000, 0x10000080 } }, // bsr
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xbd0f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xbd0f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xc80f, 0x0, { 0x80000000 } }, // bswap
+	{ 0, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xc80f, 0x0, { 0x200000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa30f, 0x66, { 0x10000080, 0x10000000 } }, // bt
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa30f, 0x0, { 0x80000100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa30f, 0x0, { 0x200000200, 0x200000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xba0f, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xba0f, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 2, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xba0f, 0x0, { 0x200000200, 0x2 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xbb0f, 0x66, { 0x10000080, 0x10000000 } }, // btc
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xbb0f, 0x0, { 0x80000100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xbb0f, 0x0, { 0x200000200, 0x200000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0xba0f, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0xba0f, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 2, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0xba0f, 0x0, { 0x200000200, 0x2 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xb30f, 0x66, { 0x10000080, 0x10000000 } }, // btr
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xb30f, 0x0, { 0x80000100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xb30f, 0x0, { 0x200000200, 0x200000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 0, 0x0, 0x0, 0x30, 1, 0, 0, 2, 0xba0f, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 0, 0x0, 0x0, 0x30, 1, 0, 0, 2, 0xba0f, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 2, 0, 0x0, 0x0, 0x30, 1, 0, 0, 2, 0xba0f, 0x0, { 0x200000200, 0x2 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xab0f, 0x66, { 0x10000080, 0x10000000 } }, // bts
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xab0f, 0x0, { 0x80000100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xab0f, 0x0, { 0x200000200, 0x200000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0xba0f, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0xba0f, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 2, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0xba0f, 0x0, { 0x200000200, 0x2 } },
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0x78, 0x0, 1, 1, 0, 3, 0xf5, 0x0, { 0x80000000, 0x80000100, 0x80000000 } }, // bzhi
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0xf8, 0x0, 1, 1, 0, 3, 0xf5, 0x0, { 0x200000000, 0x200000200, 0x200000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xe8, 0x0, { 0x1000000000 } }, // call
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0xff, 0x0, { 0x200000200 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xff, 0x0, { 0x2000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xff, 0x0, { 0x4000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xff, 0x0, { 0x8000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x98, 0x66, {  } }, // cbw
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x98, 0x0, {  } }, // cwde
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x98, 0x0, {  } }, // cdqe
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf8, 0x0, {  } }, // clc
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xfc, 0x0, {  } }, // cld
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x38, 1, 0, 0, 1, 0xae0f, 0x0, { 0x40 } }, // clflush
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xfa, 0x0, {  } }, // cli
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x60f, 0x0, {  } }, // clts
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf5, 0x0, {  } }, // cmc
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x470f, 0x66, { 0x10000000, 0x10000080 } }, // cmova
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x470f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x470f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x430f, 0x66, { 0x10000000, 0x10000080 } }, // cmovae
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x430f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x430f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x420f, 0x66, { 0x10000000, 0x10000080 } }, // cmovb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x420f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x420f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x460f, 0x66, { 0x10000000, 0x10000080 } }, // cmovbe
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x460f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x460f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x420f, 0x66, { 0x10000000, 0x10000080 } }, // cmovc
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x420f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x420f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x440f, 0x66, { 0x10000000, 0x10000080 } }, // cmove
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x440f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x440f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4f0f, 0x66, { 0x10000000, 0x10000080 } }, // cmovg
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4f0f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4f0f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4d0f, 0x66, { 0x10000000, 0x10000080 } }, // cmovge
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4d0f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4d0f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4c0f, 0x66, { 0x10000000, 0x10000080 } }, // cmovl
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4c0f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4c0f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4e0f, 0x66, { 0x10000000, 0x10000080 } }, // cmovle
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4e0f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4e0f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x460f, 0x66, { 0x10000000, 0x10000080 } }, // cmovna
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x460f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x460f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x420f, 0x66, { 0x10000000, 0x10000080 } }, // cmovnae
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x420f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x420f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x430f, 0x66, { 0x10000000, 0x10000080 } }, // cmovnb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x430f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x430f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x470f, 0x66, { 0x10000000, 0x10000080 } }, // cmovnbe
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x470f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x470f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x430f, 0x66, { 0x10000000, 0x10000080 } }, // cmovnc
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x430f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x430f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x450f, 0x66, { 0x10000000, 0x10000080 } }, // cmovne
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x450f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x450f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4e0f, 0x66, { 0x10000000, 0x10000080 } }, // cmovng
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4e0f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4e0f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4c0f, 0x66, { 0x10000000, 0x10000080 } }, // cmovnge
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4c0f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4c0f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4d0f, 0x66, { 0x10000000, 0x10000080 } }, // cmovnl
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4d0f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4d0f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4f0f, 0x66, { 0x10000000, 0x10000080 } }, // cmovnle
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4f0f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4f0f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x410f, 0x66, { 0x10000000, 0x10000080 } }, // cmovno
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x410f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x410f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4b0f, 0x66, { 0x10000000, 0x10000080 } }, // cmovnp
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4b0f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4b0f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x490f, 0x66, { 0x10000000, 0x10000080 } }, // cmovns
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x490f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x490f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x450f, 0x66, { 0x10000000, 0x10000080 } }, // cmovnz
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x450f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x450f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x400f, 0x66, { 0x10000000, 0x10000080 } }, // cmovo
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x400f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x400f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4a0f, 0x66, { 0x10000000, 0x10000080 } }, // cmovp
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4a0f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4a0f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4a0f, 0x66, { 0x10000000, 0x10000080 } }, // cmovpe
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4a0f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4a0f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4b0f, 0x66, { 0x10000000, 0x10000080 } }, // cmovpo
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4b0f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4b0f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x480f, 0x66, { 0x10000000, 0x10000080 } }, // cmovs
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x480f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x480f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x440f, 0x66, { 0x10000000, 0x10000080 } }, // cmovz
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x440f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x440f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x3c, 0x0, { 0x4000000, 0x2 } }, // cmp
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x3d, 0x66, { 0x20000000, 0x4 } },
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x3d, 0x0, { 0x100000000, 0x8 } },
+	{ 0, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x3d, 0x0, { 0x400000000, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0x80, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0x81, 0x66, { 0x10000080, 0x4 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0x81, 0x0, { 0x80000100, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0x81, 0x0, { 0x200000200, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 1, 2, 0x83, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 1, 2, 0x83, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x38, 1, 0, 1, 2, 0x83, 0x0, { 0x200000200, 0x2 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x38, 0x0, { 0x1000040, 0x1000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x38, 0x0, { 0x1000040, 0x2000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x39, 0x66, { 0x10000080, 0x10000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x39, 0x0, { 0x80000100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x39, 0x0, { 0x200000200, 0x200000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3a, 0x0, { 0x1000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3a, 0x0, { 0x2000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3b, 0x66, { 0x10000000, 0x10000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3b, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3b, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0xc20f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } }, // cmppd
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 4, 0xc2, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400, 0x2 } }, // vcmppd
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 4, 0xc2, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800, 0x2 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0xc20f, 0x0, { 0x40000000000, 0x40000000400, 0x2 } }, // cmpps
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 4, 0xc2, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400, 0x2 } }, // vcmpps
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 4, 0xc2, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800, 0x2 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa6, 0x0, { 0x40, 0x40 } }, // cmps
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa7, 0x66, { 0x80, 0x80 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa7, 0x0, { 0x100, 0x100 } },
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa7, 0x0, { 0x200, 0x200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xa6, 0x0, {  } }, // cmpsb
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xa7, 0x66, {  } }, // cmpsw
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xa7, 0x0, {  } }, // cmpsd
+	{ 2, 1, 0, 0, 3, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0xc20f, 0xf2, { 0x40000000000, 0x40000000200, 0x2 } },
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xa7, 0x0, {  } }, // cmpsq
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 4, 0xc2, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200, 0x2 } }, // vcmpsd
+	{ 2, 1, 0, 0, 3, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0xc20f, 0xf3, { 0x40000000000, 0x40000000100, 0x2 } }, // cmpss
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 4, 0xc2, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100, 0x2 } }, // vcmpss
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb00f, 0x0, { 0x1000040, 0x1000000 } }, // cmpxchg
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb00f, 0x0, { 0x1000040, 0x2000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb10f, 0x66, { 0x10000080, 0x10000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb10f, 0x0, { 0x80000100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb10f, 0x0, { 0x200000200, 0x200000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xc70f, 0x0, { 0x200 } }, // cmpxchg8b
+	{ 1, 0, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xc70f, 0x0, { 0x400 } }, // cmpxchg16b
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2f0f, 0x66, { 0x40000000000, 0x40000000200 } }, // comisd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0x2f, 0x0, { 0x40000000000, 0x40000000200 } }, // vcomisd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2f0f, 0x0, { 0x40000000000, 0x40000000100 } }, // comiss
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 2, 0x2f, 0x0, { 0x40000000000, 0x40000000100 } }, // vcomiss
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xa20f, 0x0, {  } }, // cpuid
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf0380f, 0xf2, { 0x80000000, 0x1000040 } }, // crc32
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf1380f, 0xf2, { 0x80000000, 0x10000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf1380f, 0xf2, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf0380f, 0xf2, { 0x200000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf1380f, 0xf2, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xe60f, 0xf3, { 0x40000000000, 0x40000000200 } }, // cvtdq2pd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 2, 0xe6, 0x0, { 0x40000000000, 0x40000000200 } }, // vcvtdq2pd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7e, 0x0, 1, 1, 0, 2, 0xe6, 0x0, { 0x100000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5b0f, 0x0, { 0x40000000000, 0x40000000400 } }, // cvtdq2ps
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 2, 0x5b, 0x0, { 0x40000000000, 0x40000000400 } }, // vcvtdq2ps
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 2, 0x5b, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xe60f, 0xf2, { 0x40000000000, 0x40000000400 } }, // cvtpd2dq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 2, 0xe6, 0x0, { 0x40000000000, 0x40000000400 } }, // vcvtpd2dq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7f, 0x0, 1, 1, 0, 2, 0xe6, 0x0, { 0x40000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2d0f, 0x66, { 0x10000, 0x40000000400 } }, // cvtpd2pi
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5a0f, 0x66, { 0x40000000000, 0x40000000400 } }, // cvtpd2ps
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0x5a, 0x0, { 0x40000000000, 0x40000000400 } }, // vcvtpd2ps
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 2, 0x5a, 0x0, { 0x40000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2a0f, 0x66, { 0x40000000000, 0x10200 } }, // cvtpi2pd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2a0f, 0x0, { 0x40000000000, 0x10200 } }, // cvtpi2ps
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5b0f, 0x66, { 0x40000000000, 0x40000000400 } }, // cvtps2dq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0x5b, 0x0, { 0x40000000000, 0x40000000400 } }, // vcvtps2dq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 2, 0x5b, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5a0f, 0x0, { 0x40000000000, 0x40000000200 } }, // cvtps2pd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 2, 0x5a, 0x0, { 0x40000000000, 0x40000000200 } }, // vcvtps2pd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 2, 0x5a, 0x0, { 0x100000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2d0f, 0x0, { 0x10000, 0x40000000200 } }, // cvtps2pi
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2d0f, 0xf2, { 0x80000000, 0x40000000200 } }, // cvtsd2si
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2d0f, 0xf2, { 0x200000000, 0x40000000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 2, 0x2d, 0x0, { 0x80000000, 0x40000000200 } }, // vcvtsd2si
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0xfb, 0x0, 1, 1, 0, 2, 0x2d, 0x0, { 0x200000000, 0x40000000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5a0f, 0xf2, { 0x40000000000, 0x40000000200 } }, // cvtsd2ss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 3, 0x5a, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vcvtsd2ss
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2a0f, 0xf2, { 0x40000000000, 0x80000100 } }, // cvtsi2sd
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2a0f, 0xf2, { 0x40000000000, 0x200000200 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 3, 0x2a, 0x0, { 0x40000000000, 0x40000000000, 0x80000100 } }, // vcvtsi2sd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0xfb, 0x0, 1, 1, 0, 3, 0x2a, 0x0, { 0x40000000000, 0x40000000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2a0f, 0xf3, { 0x40000000000, 0x80000100 } }, // cvtsi2ss
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2a0f, 0xf3, { 0x40000000000, 0x200000200 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 3, 0x2a, 0x0, { 0x40000000000, 0x40000000000, 0x80000100 } }, // vcvtsi2ss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0xfa, 0x0, 1, 1, 0, 3, 0x2a, 0x0, { 0x40000000000, 0x40000000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5a0f, 0xf3, { 0x40000000000, 0x40000000100 } }, // cvtss2sd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 3, 0x5a, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vcvtss2sd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2d0f, 0xf3, { 0x80000000, 0x40000000100 } }, // cvtss2si
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2d0f, 0xf3, { 0x200000000, 0x40000000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 2, 0x2d, 0x0, { 0x80000000, 0x40000000100 } }, // vcvtss2si
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0xfa, 0x0, 1, 1, 0, 2, 0x2d, 0x0, { 0x200000000, 0x40000000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xe60f, 0x66, { 0x40000000000, 0x40000000400 } }, // cvttpd2dq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0xe6, 0x0, { 0x40000000000, 0x40000000400 } }, // vcvttpd2dq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 2, 0xe6, 0x0, { 0x40000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2c0f, 0x66, { 0x10000, 0x40000000400 } }, // cvttpd2pi
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5b0f, 0xf3, { 0x40000000000, 0x40000000400 } }, // cvttps2dq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 2, 0x5b, 0x0, { 0x40000000000, 0x40000000400 } }, // vcvttps2dq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7e, 0x0, 1, 1, 0, 2, 0x5b, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2c0f, 0x0, { 0x10000, 0x40000000200 } }, // cvttps2pi
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2c0f, 0xf2, { 0x80000000, 0x40000000200 } }, // cvttsd2si
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2c0f, 0xf2, { 0x200000000, 0x40000000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 2, 0x2c, 0x0, { 0x80000000, 0x40000000200 } }, // vcvttsd2si
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0xfb, 0x0, 1, 1, 0, 2, 0x2c, 0x0, { 0x200000000, 0x40000000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2c0f, 0xf3, { 0x80000000, 0x40000000100 } }, // cvttss2si
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2c0f, 0xf3, { 0x200000000, 0x40000000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 2, 0x2c, 0x0, { 0x80000000, 0x40000000100 } }, // vcvttss2si
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0xfa, 0x0, 1, 1, 0, 2, 0x2c, 0x0, { 0x200000000, 0x40000000100 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x99, 0x66, {  } }, // cwd
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x99, 0x0, {  } }, // cdq
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x99, 0x0, {  } }, // cqo
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xfe, 0x0, { 0x1000040 } }, // dec
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xff, 0x0, { 0x10000080 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xff, 0x0, { 0x80000100 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xff, 0x0, { 0x200000200 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xf6, 0x0, { 0x1000040 } }, // div
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xf7, 0x0, { 0x10000080 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xf7, 0x0, { 0x80000100 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xf7, 0x0, { 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5e0f, 0x66, { 0x40000000000, 0x40000000400 } }, // divpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x5e, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vdivpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x5e, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5e0f, 0x0, { 0x40000000000, 0x40000000400 } }, // divps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 3, 0x5e, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vdivps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 3, 0x5e, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5e0f, 0xf2, { 0x40000000000, 0x40000000200 } }, // divsd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 3, 0x5e, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vdivsd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5e0f, 0xf3, { 0x40000000000, 0x40000000100 } }, // divss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 3, 0x5e, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vdivss
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x413a0f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } }, // dppd
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 4, 0x41, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400, 0x2 } }, // vdppd
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x403a0f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } }, // dpps
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 4, 0x40, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400, 0x2 } }, // vdpps
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 4, 0x40, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800, 0x2 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x770f, 0x0, {  } }, // emms
+	{ 0, 0, 0, 0, 1, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xc8, 0x0, { 0x4, 0x2 } }, // enter
+	{ 1, 2, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x173a0f, 0x66, { 0x280000100, 0x40000000000, 0x2 } }, // extractps
+	{ 1, 2, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 3, 0x17, 0x0, { 0x80000100, 0x40000000000, 0x2 } }, // vextractps
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf0d9, 0x0, {  } }, // f2xm1
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xe1d9, 0x0, {  } }, // fabs
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xd8, 0x0, { 0x100 } }, // fadd
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xdc, 0x0, { 0x200 } },
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xc0d8, 0x0, { 0x20000000000, 0x10000000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xc0dc, 0x0, { 0x10000000000, 0x20000000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xc0de, 0x0, { 0x10000000000, 0x20000000000 } }, // faddp
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xc1de, 0x0, {  } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xda, 0x0, { 0x100 } }, // fiadd
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xde, 0x66, { 0x80 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0xdf, 0x0, { 0x1fc0 } }, // fbld
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xdf, 0x0, { 0x1fc0 } }, // fbstp
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xe0d9, 0x0, {  } }, // fchs
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xe2db, 0x9b, {  } }, // fclex
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xe2db, 0x0, {  } }, // fnclex
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xc0da, 0x0, { 0x20000000000, 0x10000000000 } }, // fcmovb
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xc8da, 0x0, { 0x20000000000, 0x10000000000 } }, // fcmove
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xd0da, 0x0, { 0x20000000000, 0x10000000000 } }, // fcmovbe
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xd8da, 0x0, { 0x20000000000, 0x10000000000 } }, // fcmovu
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xc0db, 0x0, { 0x20000000000, 0x10000000000 } }, // fcmovnb
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xc8db, 0x0, { 0x20000000000, 0x10000000000 } }, // fcmovne
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xd0db, 0x0, { 0x20000000000, 0x10000000000 } }, // fcmovnbe
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xd8db, 0x0, { 0x20000000000, 0x10000000000 } }, // fcmovnu
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0xd8, 0x0, { 0x100 } }, // fcom
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0xdc, 0x0, { 0x200 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xd0d8, 0x0, { 0x10000000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xd1d8, 0x0, {  } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xd8, 0x0, { 0x100 } }, // fcomp
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xdc, 0x0, { 0x200 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xd8d8, 0x0, { 0x10000000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xd9d8, 0x0, {  } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xd9de, 0x0, {  } }, // fcompp
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xf0db, 0x0, { 0x10000000000, 0x10000000000 } }, // fcomi
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xf0df, 0x0, { 0x10000000000, 0x10000000000 } }, // fcomip
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xe8db, 0x0, { 0x10000000000, 0x10000000000 } }, // fucomi
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xe8df, 0x0, { 0x10000000000, 0x10000000000 } }, // fucomip
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xffd9, 0x0, {  } }, // fcos
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf6d9, 0x0, {  } }, // fdecstp
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xd8, 0x0, { 0x100 } }, // fdiv
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xdc, 0x0, { 0x200 } },
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xf0d8, 0x0, { 0x20000000000, 0x10000000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xf0dc, 0x0, { 0x10000000000, 0x20000000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xf0de, 0x0, { 0x10000000000, 0x20000000000 } }, // fdivp
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf1de, 0x0, {  } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xda, 0x0, { 0x100 } }, // fidiv
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xde, 0x66, { 0x80 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 1, 0xd8, 0x0, { 0x100 } }, // fdivr
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 1, 0xdc, 0x0, { 0x200 } },
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xf8d8, 0x0, { 0x20000000000, 0x10000000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xf8dc, 0x0, { 0x10000000000, 0x20000000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xf8de, 0x0, { 0x10000000000, 0x20000000000 } }, // fdivrp
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf9de, 0x0, {  } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 1, 0xda, 0x0, { 0x100 } }, // fidivr
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x38, 1, 0, 0, 1, 0xde, 0x66, { 0x80 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xc0dd, 0x0, { 0x10000000000 } }, // ffree
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0xde, 0x66, { 0x80 } }, // ficom
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0xda, 0x0, { 0x100 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xde, 0x66, { 0x80 } }, // ficomp
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xda, 0x0, { 0x100 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xdf, 0x66, { 0x80 } }, // fild
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xdb, 0x0, { 0x100 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 1, 0xdf, 0x0, { 0x200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf7d9, 0x0, {  } }, // fincstp
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xe3db, 0x9b, {  } }, // finit
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xe3db, 0x0, {  } }, // fninit
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0xdf, 0x66, { 0x80 } }, // fist
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0xdb, 0x0, { 0x100 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xdf, 0x66, { 0x80 } }, // fistp
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xdb, 0x0, { 0x100 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 1, 0xdf, 0x0, { 0x200 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xdf, 0x66, { 0x80 } }, // fisttp
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xdb, 0x0, { 0x100 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xdd, 0x0, { 0x200 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xd9, 0x0, { 0x100 } }, // fld
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xdd, 0x0, { 0x200 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 1, 0xdb, 0x0, { 0x1fc0 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xc0d9, 0x0, { 0x10000000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xe8d9, 0x0, {  } }, // fld1
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xe9d9, 0x0, {  } }, // fldl2t
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xead9, 0x0, {  } }, // fldl2e
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xebd9, 0x0, {  } }, // fldpi
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xecd9, 0x0, {  } }, // fldlg2
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xedd9, 0x0, {  } }, // fldln2
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xeed9, 0x0, {  } }, // fldz
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 1, 0xd9, 0x0, { 0x100 } }, // fldcw
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0xd9, 0x0, { 0x100 } }, // fldenv
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xd8, 0x0, { 0x100 } }, // fmul
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xdc, 0x0, { 0x200 } },
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xc8d8, 0x0, { 0x20000000000, 0x10000000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xc8dc, 0x0, { 0x10000000000, 0x20000000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xc8de, 0x0, { 0x10000000000, 0x20000000000 } }, // fmulp
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xc9de, 0x0, {  } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xda, 0x0, { 0x100 } }, // fimul
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xde, 0x66, { 0x80 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xd0d9, 0x0, {  } }, // fnop
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf3d9, 0x0, {  } }, // fpatan
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf8d9, 0x0, {  } }, // fprem
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf5d9, 0x0, {  } }, // fprem1
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf2d9, 0x0, {  } }, // fptan
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xfcd9, 0x0, {  } }, // frndint
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0xdd, 0x0, { 0x1fc0 } }, // frstor
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xdd, 0x9b, { 0x1fc0 } }, // fsave
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xdd, 0x0, { 0x1fc0 } }, // fnsave
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xfdd9, 0x0, {  } }, // fscale
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xfed9, 0x0, {  } }, // fsin
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xfbd9, 0x0, {  } }, // fsincos
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xfad9, 0x0, {  } }, // fsqrt
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0xd9, 0x0, { 0x100 } }, // fst
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0xdd, 0x0, { 0x200 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xd0dd, 0x0, { 0x10000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xd9, 0x0, { 0x100 } }, // fstp
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xdd, 0x0, { 0x200 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 1, 0xdb, 0x0, { 0x1fc0 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xd8dd, 0x0, { 0x10000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x38, 1, 0, 0, 1, 0xd9, 0x9b, { 0x100 } }, // fstcw
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 1, 0xd9, 0x0, { 0x100 } }, // fnstcw
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xd9, 0x9b, { 0x100 } }, // fstenv
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xd9, 0x0, { 0x100 } }, // fnstenv
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x38, 1, 0, 0, 1, 0xdd, 0x9b, { 0x100 } }, // fstsw
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xe0df, 0x9b, { 0x20000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 1, 0xdd, 0x0, { 0x100 } }, // fnstsw
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xe0df, 0x0, { 0x20000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0xd8, 0x0, { 0x100 } }, // fsub
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0xdc, 0x0, { 0x200 } },
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xe0d8, 0x0, { 0x20000000000, 0x10000000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xe0dc, 0x0, { 0x10000000000, 0x20000000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xe0de, 0x0, { 0x10000000000, 0x20000000000 } }, // fsubp
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xe1de, 0x0, {  } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0xda, 0x0, { 0x100 } }, // fisub
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0xde, 0x66, { 0x80 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 1, 0xd8, 0x0, { 0x100 } }, // fsubr
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 1, 0xdc, 0x0, { 0x200 } },
+	{ 0, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xe8d8, 0x0, { 0x20000000000, 0x10000000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xe8dc, 0x0, { 0x10000000000, 0x20000000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xe8de, 0x0, { 0x10000000000, 0x20000000000 } }, // fsubrp
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xe9de, 0x0, {  } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 1, 0xda, 0x0, { 0x100 } }, // fisubr
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x28, 1, 0, 0, 1, 0xde, 0x66, { 0x80 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xe4d9, 0x0, {  } }, // ftst
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xe0dd, 0x0, { 0x10000000000 } }, // fucom
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xe1dd, 0x0, {  } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xe8dd, 0x0, { 0x10000000000 } }, // fucomp
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xe9dd, 0x0, {  } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xe9da, 0x0, {  } }, // fucompp
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xe5d9, 0x0, {  } }, // fxam
+	{ 0, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xc8d9, 0x0, { 0x10000000000 } }, // fxch
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xc9d9, 0x0, {  } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xae0f, 0x0, { 0x1000 } }, // fxrstor
+	{ 1, 0, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xae0f, 0x0, { 0x1000 } }, // fxrstor64
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xae0f, 0x0, { 0x1000 } }, // fxsave
+	{ 1, 0, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xae0f, 0x0, { 0x1000 } }, // fxsave64
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf4d9, 0x0, {  } }, // fxtract
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf1d9, 0x0, {  } }, // fyl2x
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf9d9, 0x0, {  } }, // fyl2xp1
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x7c0f, 0x66, { 0x40000000000, 0x40000000400 } }, // haddpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x7c, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vhaddpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x7c, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x7c0f, 0xf2, { 0x40000000000, 0x40000000400 } }, // haddps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 3, 0x7c, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vhaddps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7f, 0x0, 1, 1, 0, 3, 0x7c, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf4, 0x0, {  } }, // hlt
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x7d0f, 0x66, { 0x40000000000, 0x40000000400 } }, // hsubpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x7d, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vhsubpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x7d, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x7d0f, 0xf2, { 0x40000000000, 0x40000000400 } }, // hsubps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 3, 0x7d, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vhsubps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7f, 0x0, 1, 1, 0, 3, 0x7d, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 1, 0xf6, 0x0, { 0x1000040 } }, // idiv
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 1, 0xf7, 0x0, { 0x10000080 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 1, 0xf7, 0x0, { 0x80000100 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 1, 0xf7, 0x0, { 0x200000200 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 1, 0xf6, 0x0, { 0x1000040 } }, // imul
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 1, 0xf7, 0x0, { 0x10000080 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 1, 0xf7, 0x0, { 0x80000100 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 1, 0xf7, 0x0, { 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xaf0f, 0x66, { 0x10000000, 0x10000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xaf0f, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xaf0f, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x6b, 0x66, { 0x10000000, 0x10000080, 0x2 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x6b, 0x0, { 0x80000000, 0x80000100, 0x2 } },
+	{ 2, 1, 0, 0, 3, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x6b, 0x0, { 0x200000000, 0x200000200, 0x2 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x69, 0x66, { 0x10000000, 0x10000080, 0x4 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x69, 0x0, { 0x80000000, 0x80000100, 0x8 } },
+	{ 2, 1, 0, 0, 3, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x69, 0x0, { 0x200000000, 0x200000200, 0x8 } },
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xe4, 0x0, { 0x4000000, 0x2 } }, // in
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xe5, 0x66, { 0x20000000, 0x2 } },
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xe5, 0x0, { 0x100000000, 0x2 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xec, 0x0, { 0x4000000, 0x40000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xed, 0x66, { 0x20000000, 0x40000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xed, 0x0, { 0x100000000, 0x40000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xfe, 0x0, { 0x1000040 } }, // inc
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xff, 0x0, { 0x10000080 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xff, 0x0, { 0x80000100 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xff, 0x0, { 0x200000200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x6c, 0x0, { 0x40, 0x40000000 } }, // ins
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x6d, 0x66, { 0x80, 0x40000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x6d, 0x0, { 0x100, 0x40000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x6c, 0x0, {  } }, // insb
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x6d, 0x66, {  } }, // insw
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x6d, 0x0, {  } }, // insd
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x213a0f, 0x66, { 0x40000000000, 0x40000000100, 0x2 } }, // insertps
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 4, 0x21, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100, 0x2 } }, // vinsertps
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xcc, 0x0, {  } }, // int3
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf1, 0x0, {  } }, // int1
+	{ 0, 0, 0, 0, 1, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xcd, 0x0, { 0x2 } }, // int
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x80f, 0x0, {  } }, // invd
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x38, 1, 0, 0, 1, 0x10f, 0x0, { 0x1fc0 } }, // invlpg
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x82380f, 0x66, { 0x200000000, 0x400 } }, // invpcid
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xcf, 0x66, {  } }, // iret
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xcf, 0x0, {  } }, // iretd
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xcf, 0x0, {  } }, // iretq
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x77, 0x0, { 0x800000000 } }, // ja
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x870f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x73, 0x0, { 0x800000000 } }, // jae
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x830f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x72, 0x0, { 0x800000000 } }, // jb
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x820f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x76, 0x0, { 0x800000000 } }, // jbe
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x860f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x72, 0x0, { 0x800000000 } }, // jc
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x820f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xe3, 0x0, { 0x800000000 } }, // jecxz
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xe3, 0x0, { 0x800000000 } }, // jrcxz
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x74, 0x0, { 0x800000000 } }, // je
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x840f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x7f, 0x0, { 0x800000000 } }, // jg
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x8f0f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x7d, 0x0, { 0x800000000 } }, // jge
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x8d0f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x7c, 0x0, { 0x800000000 } }, // jl
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x8c0f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x7e, 0x0, { 0x800000000 } }, // jle
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x8e0f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x76, 0x0, { 0x800000000 } }, // jna
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x860f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x72, 0x0, { 0x800000000 } }, // jnae
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x820f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x73, 0x0, { 0x800000000 } }, // jnb
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x830f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x77, 0x0, { 0x800000000 } }, // jnbe
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x870f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x73, 0x0, { 0x800000000 } }, // jnc
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x830f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x75, 0x0, { 0x800000000 } }, // jne
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x850f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x7e, 0x0, { 0x800000000 } }, // jng
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x8e0f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x7c, 0x0, { 0x800000000 } }, // jnge
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x8c0f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x7d, 0x0, { 0x800000000 } }, // jnl
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x8d0f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x7f, 0x0, { 0x800000000 } }, // jnle
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x8f0f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x71, 0x0, { 0x800000000 } }, // jno
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x810f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x7b, 0x0, { 0x800000000 } }, // jnp
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x8b0f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x79, 0x0, { 0x800000000 } }, // jns
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x890f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x75, 0x0, { 0x800000000 } }, // jnz
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x850f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x70, 0x0, { 0x800000000 } }, // jo
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x800f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x7a, 0x0, { 0x800000000 } }, // jp
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x8a0f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x7a, 0x0, { 0x800000000 } }, // jpe
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x8a0f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x7b, 0x0, { 0x800000000 } }, // jpo
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x8b0f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x78, 0x0, { 0x800000000 } }, // js
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x880f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x74, 0x0, { 0x800000000 } }, // jz
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x840f, 0x0, { 0x1000000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xeb, 0x0, { 0x800000000 } }, // jmp
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xe9, 0x0, { 0x1000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0xff, 0x0, { 0x200000200 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 1, 0xff, 0x0, { 0x2000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 1, 0xff, 0x0, { 0x4000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 1, 0xff, 0x0, { 0x8000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x9f, 0x0, {  } }, // lahf
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x20f, 0x66, { 0x10000000, 0x10000080 } }, // lar
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x20f, 0x0, { 0x80000000, 0x80000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x20f, 0x0, { 0x200000000, 0x80000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf00f, 0xf2, { 0x40000000000, 0x400 } }, // lddqu
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 2, 0xf0, 0x0, { 0x40000000000, 0x400 } }, // vlddqu
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7f, 0x0, 1, 1, 0, 2, 0xf0, 0x0, { 0x100000000000, 0x800 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0xae0f, 0x0, { 0x100 } }, // ldmxcsr
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x10, 1, 0, 0, 1, 0xae, 0x0, { 0x100 } }, // vldmxcsr
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb20f, 0x66, { 0x10000000, 0x2000 } }, // lss
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb20f, 0x0, { 0x80000000, 0x4000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb20f, 0x0, { 0x200000000, 0x8000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb40f, 0x66, { 0x10000000, 0x2000 } }, // lfs
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb40f, 0x0, { 0x80000000, 0x4000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb40f, 0x0, { 0x200000000, 0x8000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb50f, 0x66, { 0x10000000, 0x2000 } }, // lgs
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb50f, 0x0, { 0x80000000, 0x4000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb50f, 0x0, { 0x200000000, 0x8000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x8d, 0x0, { 0x10000000, 0x1fc0 } }, // lea
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x8d, 0x0, { 0x80000000, 0x1fc0 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x8d, 0x0, { 0x200000000, 0x1fc0 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xc9, 0x66, { 0x20000 } }, // leave
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xc9, 0x0, {  } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xe8ae0f, 0x0, {  } }, // lfence
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0x10f, 0x0, { 0x8000 } }, // lgdt
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0x10f, 0x0, { 0x8000 } }, // lidt
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0xf, 0x0, { 0x10000080 } }, // lldt
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0x10f, 0x0, { 0x10000080 } }, // lmsw
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf0, 0x0, {  } }, // lock
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xac, 0x0, { 0x40 } }, // lods
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xad, 0x66, { 0x80 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xad, 0x0, { 0x100 } },
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xad, 0x0, { 0x200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xac, 0x0, {  } }, // lodsb
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xad, 0x66, {  } }, // lodsw
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xad, 0x0, {  } }, // lodsd
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xad, 0x0, {  } }, // lodsq
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xe2, 0x0, { 0x800000000 } }, // loop
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xe0, 0x0, { 0x800000000 } }, // loope
+	{ 0, 0, 1, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xe0, 0x0, { 0x800000000 } }, // loopne
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x30f, 0x66, { 0x10000000, 0x10000080 } }, // lsl
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x30f, 0x0, { 0x80000000, 0x80000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x30f, 0x0, { 0x200000000, 0x80000080 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xf, 0x0, { 0x10000080 } }, // ltr
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 2, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xbd0f, 0xf366, { 0x10000000, 0x10000080 } }, // lzcnt
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xbd0f, 0xf3, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xbd0f, 0xf3, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf70f, 0x66, { 0x40000000000, 0x40000000000 } }, // maskmovdqu
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0xf7, 0x0, { 0x40000000000, 0x40000000000 } }, // vmaskmovdqu
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf70f, 0x0, { 0x10000, 0x10000 } }, // maskmovq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5f0f, 0x66, { 0x40000000000, 0x40000000400 } }, // maxpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x5f, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vmaxpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x5f, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5f0f, 0x0, { 0x40000000000, 0x40000000400 } }, // maxps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 3, 0x5f, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vmaxps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 3, 0x5f, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5f0f, 0xf2, { 0x40000000000, 0x40000000200 } }, // maxsd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 3, 0x5f, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vmaxsd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5f0f, 0xf3, { 0x40000000000, 0x40000000100 } }, // maxss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 3, 0x5f, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vmaxss
+	{ 0, 0, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf0ae0f, 0x0, {  } }, // mfence
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5d0f, 0x66, { 0x40000000000, 0x40000000400 } }, // minpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x5d, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vminpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x5d, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5d0f, 0x0, { 0x40000000000, 0x40000000400 } }, // minps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 3, 0x5d, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vminps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 3, 0x5d, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5d0f, 0xf2, { 0x40000000000, 0x40000000200 } }, // minsd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 3, 0x5d, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vminsd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5d0f, 0xf3, { 0x40000000000, 0x40000000100 } }, // minss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 3, 0x5d, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vminss
+	{ 0, 0, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xc8010f, 0x0, {  } }, // monitor
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x88, 0x0, { 0x1000040, 0x1000000 } }, // mov
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x88, 0x0, { 0x1000040, 0x2000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x89, 0x66, { 0x10000080, 0x10000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x89, 0x0, { 0x80000100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x89, 0x0, { 0x200000200, 0x200000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x8a, 0x0, { 0x1000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x8a, 0x0, { 0x2000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x8b, 0x66, { 0x10000000, 0x10000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x8b, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x8b, 0x0, { 0x200000000, 0x200000200 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x8c, 0x0, { 0x10000080, 0x2000000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x8c, 0x0, { 0x200000200, 0x2000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x8e, 0x0, { 0x2000000000, 0x10000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x8e, 0x0, { 0x2000000000, 0x200000200 } },
+	{ 0, 0, 2, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa0, 0x0, { 0x4000000, 0x100000 } },
+	{ 0, 0, 2, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 3, 0xa0, 0x0, { 0x4000000, 0x100000, 0x40000 } },
+	{ 0, 0, 2, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa1, 0x66, { 0x20000000, 0x200000 } },
+	{ 0, 0, 2, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa1, 0x0, { 0x100000000, 0x400000 } },
+	{ 0, 0, 2, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa1, 0x0, { 0x400000000, 0x800000 } },
+	{ 0, 0, 2, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa2, 0x0, { 0x100000, 0x4000000 } },
+	{ 0, 0, 2, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 3, 0xa2, 0x0, { 0x100000, 0x4000000, 0x40000 } },
+	{ 0, 0, 2, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa3, 0x66, { 0x200000, 0x20000000 } },
+	{ 0, 0, 2, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa3, 0x0, { 0x400000, 0x100000000 } },
+	{ 0, 0, 2, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa3, 0x0, { 0x800000, 0x400000000 } },
+	{ 0, 1, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0xb0, 0x0, { 0x1000000, 0x2 } },
+	{ 0, 1, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0xb0, 0x0, { 0x2000000, 0x2 } },
+	{ 0, 1, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0xb8, 0x66, { 0x10000000, 0x4 } },
+	{ 0, 1, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0xb8, 0x0, { 0x80000000, 0x8 } },
+	{ 0, 1, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xb8, 0x0, { 0x200000000, 0x10 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xc6, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xc7, 0x66, { 0x10000080, 0x4 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xc7, 0x0, { 0x80000100, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 0, 1, 2, 0xc7, 0x0, { 0x200000200, 0x8 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x200f, 0x0, { 0x200000000, 0x400000000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x44, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x200f, 0x0, { 0x200000000, 0x800000000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x220f, 0x0, { 0x400000000000, 0x200000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x44, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x220f, 0x0, { 0x800000000000, 0x200000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x210f, 0x0, { 0x200000000, 0x1000000000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x230f, 0x0, { 0x1000000000000, 0x200000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x280f, 0x66, { 0x40000000000, 0x40000000400 } }, // movapd
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x290f, 0x66, { 0x40000000400, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 1, 2, 0x28, 0x0, { 0x40000000000, 0x40000000400 } }, // vmovapd
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0x29, 0x0, { 0x40000000400, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 1, 2, 0x28, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 2, 0x29, 0x0, { 0x100000000800, 0x100000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x280f, 0x0, { 0x40000000000, 0x40000000400 } }, // movaps
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x290f, 0x0, { 0x40000000400, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 1, 2, 0x28, 0x0, { 0x40000000000, 0x40000000400 } }, // vmovaps
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 2, 0x29, 0x0, { 0x40000000400, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 1, 2, 0x28, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 2, 0x29, 0x0, { 0x100000000800, 0x100000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf0380f, 0x66, { 0x10000000, 0x80 } }, // movbe
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf0380f, 0x0, { 0x80000000, 0x100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf0380f, 0x0, { 0x200000000, 0x200 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf1380f, 0x66, { 0x80, 0x10000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf1380f, 0x0, { 0x100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf1380f, 0x0, { 0x200, 0x200000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x6e0f, 0x0, { 0x10000, 0x80000100 } }, // movd
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x7e0f, 0x0, { 0x80000100, 0x10000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x6e0f, 0x66, { 0x40000000000, 0x80000100 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x7e0f, 0x66, { 0x80000100, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x6e0f, 0x0, { 0x10000, 0x200000200 } }, // movq
+	{ 1, 2, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x7e0f, 0x0, { 0x200000200, 0x10000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x6e0f, 0x66, { 0x40000000000, 0x200000200 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 2, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x7e0f, 0x66, { 0x200000200, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x6f0f, 0x0, { 0x10000, 0x10200 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x7f0f, 0x0, { 0x10200, 0x10000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x7e0f, 0xf3, { 0x40000000000, 0x40000000200 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd60f, 0x66, { 0x40000000200, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0x6e, 0x0, { 0x40000000000, 0x80000100 } }, // vmovd
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0x7e, 0x0, { 0x80000100, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0xf9, 0x0, 1, 1, 1, 2, 0x6e, 0x0, { 0x40000000000, 0x200000200 } }, // vmovq
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0xf9, 0x0, 1, 1, 1, 2, 0x7e, 0x0, { 0x200000200, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 2, 0x7e, 0x0, { 0x40000000000, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 2, 0x7e, 0x0, { 0x40000000000, 0x200 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 1, 2, 0xd6, 0x0, { 0x40000000200, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x120f, 0xf2, { 0x40000000000, 0x40000000200 } }, // movddup
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 2, 0x12, 0x0, { 0x40000000000, 0x40000000200 } }, // vmovddup
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7f, 0x0, 1, 1, 0, 2, 0x12, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x6f0f, 0x66, { 0x40000000000, 0x40000000400 } }, // movdqa
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x7f0f, 0x66, { 0x40000000400, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 1, 2, 0x6f, 0x0, { 0x40000000000, 0x40000000400 } }, // vmovdqa
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0x7f, 0x0, { 0x40000000400, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 1, 2, 0x6f, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 2, 0x7f, 0x0, { 0x100000000800, 0x100000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x6f0f, 0xf3, { 0x40000000000, 0x40000000400 } }, // movdqu
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x7f0f, 0xf3, { 0x40000000400, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 1, 2, 0x6f, 0x0, { 0x40000000000, 0x40000000400 } }, // vmovdqu
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 2, 0x7f, 0x0, { 0x40000000400, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7e, 0x0, 1, 1, 1, 2, 0x6f, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7e, 0x0, 1, 1, 0, 2, 0x7f, 0x0, { 0x100000000800, 0x100000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xd60f, 0xf2, { 0x10000, 0x40000000000 } }, // movdq2q
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x120f, 0x0, { 0x40000000000, 0x40000000000 } }, // movhlps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 3, 0x12, 0x0, { 0x40000000000, 0x40000000000, 0x40000000000 } }, // vmovhlps
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x160f, 0x66, { 0x40000000000, 0x200 } }, // movhpd
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x170f, 0x66, { 0x200, 0x40000000000 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x16, 0x0, { 0x40000000000, 0x40000000000, 0x200 } }, // vmovhpd
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0x17, 0x0, { 0x200, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x160f, 0x0, { 0x40000000000, 0x200 } }, // movhps
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x170f, 0x0, { 0x200, 0x40000000000 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 3, 0x16, 0x0, { 0x40000000000, 0x40000000000, 0x200 } }, // vmovhps
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 2, 0x17, 0x0, { 0x200, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x160f, 0x0, { 0x40000000000, 0x40000000000 } }, // movlhps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 3, 0x16, 0x0, { 0x40000000000, 0x40000000000, 0x40000000000 } }, // vmovlhps
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x120f, 0x66, { 0x40000000000, 0x200 } }, // movlpd
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x130f, 0x66, { 0x200, 0x40000000000 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x12, 0x0, { 0x40000000000, 0x40000000000, 0x200 } }, // vmovlpd
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0x13, 0x0, { 0x200, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x120f, 0x0, { 0x40000000000, 0x200 } }, // movlps
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x130f, 0x0, { 0x200, 0x40000000000 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 3, 0x12, 0x0, { 0x40000000000, 0x40000000000, 0x200 } }, // vmovlps
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 2, 0x13, 0x0, { 0x200, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x500f, 0x66, { 0x280000000, 0x40000000000 } }, // movmskpd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0x50, 0x0, { 0x280000000, 0x40000000000 } }, // vmovmskpd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 2, 0x50, 0x0, { 0x280000000, 0x100000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x500f, 0x0, { 0x280000000, 0x40000000000 } }, // movmskps
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 2, 0x50, 0x0, { 0x280000000, 0x40000000000 } }, // vmovmskps
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 2, 0x50, 0x0, { 0x280000000, 0x100000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2a380f, 0x66, { 0x40000000000, 0x400 } }, // movntdqa
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x2a, 0x0, { 0x40000000000, 0x400 } }, // vmovntdqa
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x2a, 0x0, { 0x100000000000, 0x800 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe70f, 0x66, { 0x400, 0x40000000000 } }, // movntdq
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0xe7, 0x0, { 0x400, 0x40000000000 } }, // vmovntdq
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 2, 0xe7, 0x0, { 0x800, 0x100000000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xc30f, 0x0, { 0x100, 0x80000000 } }, // movnti
+	{ 1, 2, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xc30f, 0x0, { 0x200, 0x200000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2b0f, 0x66, { 0x400, 0x40000000000 } }, // movntpd
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0x2b, 0x0, { 0x400, 0x40000000000 } }, // vmovntpd
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 2, 0x2b, 0x0, { 0x800, 0x100000000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2b0f, 0x0, { 0x400, 0x40000000000 } }, // movntps
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 2, 0x2b, 0x0, { 0x400, 0x40000000000 } }, // vmovntps
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 2, 0x2b, 0x0, { 0x800, 0x100000000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe70f, 0x0, { 0x200, 0x10000 } }, // movntq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd60f, 0xf3, { 0x40000000000, 0x10000 } }, // movq2dq
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa4, 0x0, { 0x40, 0x40 } }, // movs
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa5, 0x66, { 0x80, 0x80 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa5, 0x0, { 0x100, 0x100 } },
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa5, 0x0, { 0x200, 0x200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xa4, 0x0, {  } }, // movsb
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xa5, 0x66, {  } }, // movsw
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xa5, 0x0, {  } }, // movsd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x100f, 0xf2, { 0x40000000000, 0x40000000200 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x110f, 0xf2, { 0x40000000200, 0x40000000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xa5, 0x0, {  } }, // movsq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 3, 0x10, 0x0, { 0x40000000000, 0x40000000000, 0x40000000000 } }, // vmovsd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 2, 0x10, 0x0, { 0x40000000000, 0x200 } },
+	{ 1, 3, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 1, 3, 0x11, 0x0, { 0x40000000000, 0x40000000000, 0x40000000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 2, 0x11, 0x0, { 0x200, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x160f, 0xf3, { 0x40000000000, 0x40000000400 } }, // movshdup
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 2, 0x16, 0x0, { 0x40000000000, 0x40000000400 } }, // vmovshdup
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7e, 0x0, 1, 1, 0, 2, 0x16, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x120f, 0xf3, { 0x40000000000, 0x40000000400 } }, // movsldup
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 2, 0x12, 0x0, { 0x40000000000, 0x40000000400 } }, // vmovsldup
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7e, 0x0, 1, 1, 0, 2, 0x12, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x100f, 0xf3, { 0x40000000000, 0x40000000100 } }, // movss
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x110f, 0xf3, { 0x40000000100, 0x40000000000 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 3, 0x10, 0x0, { 0x40000000000, 0x40000000000, 0x40000000000 } }, // vmovss
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 2, 0x10, 0x0, { 0x40000000000, 0x100 } },
+	{ 1, 3, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 1, 3, 0x11, 0x0, { 0x40000000000, 0x40000000000, 0x40000000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 2, 0x11, 0x0, { 0x100, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xbe0f, 0x66, { 0x10000000, 0x1000040 } }, // movsx
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xbe0f, 0x0, { 0x80000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xbe0f, 0x0, { 0x200000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xbf0f, 0x0, { 0x80000000, 0x10000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xbf0f, 0x0, { 0x200000000, 0x10000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x63, 0x0, { 0x200000000, 0x80000100 } }, // movsxd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x100f, 0x66, { 0x40000000000, 0x40000000400 } }, // movupd
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x110f, 0x66, { 0x40000000400, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0x10, 0x0, { 0x40000000000, 0x40000000400 } }, // vmovupd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 2, 0x10, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 1, 2, 0x11, 0x0, { 0x40000000400, 0x40000000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 1, 2, 0x11, 0x0, { 0x100000000800, 0x100000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x100f, 0x0, { 0x40000000000, 0x40000000400 } }, // movups
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x110f, 0x0, { 0x40000000400, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 2, 0x10, 0x0, { 0x40000000000, 0x40000000400 } }, // vmovups
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 2, 0x10, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 1, 2, 0x11, 0x0, { 0x40000000400, 0x40000000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 1, 2, 0x11, 0x0, { 0x100000000800, 0x100000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb60f, 0x66, { 0x10000000, 0x1000040 } }, // movzx
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb60f, 0x0, { 0x80000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb60f, 0x0, { 0x200000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb70f, 0x0, { 0x80000000, 0x10000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb70f, 0x0, { 0x200000000, 0x10000080 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x423a0f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } }, // mpsadbw
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 4, 0x42, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400, 0x2 } }, // vmpsadbw
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 4, 0x42, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0xf6, 0x0, { 0x1000040 } }, // mul
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0xf7, 0x0, { 0x10000080 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0xf7, 0x0, { 0x80000100 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0xf7, 0x0, { 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x590f, 0x66, { 0x40000000000, 0x40000000400 } }, // mulpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x59, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vmulpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x59, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x590f, 0x0, { 0x40000000000, 0x40000000400 } }, // mulps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 3, 0x59, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vmulps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 3, 0x59, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x590f, 0xf2, { 0x40000000000, 0x40000000200 } }, // mulsd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 3, 0x59, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vmulsd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x590f, 0xf3, { 0x40000000000, 0x40000000100 } }, // mulss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 3, 0x59, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vmulss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7b, 0x0, 1, 1, 0, 3, 0xf6, 0x0, { 0x80000000, 0x80000000, 0x80000100 } }, // mulx
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfb, 0x0, 1, 1, 0, 3, 0xf6, 0x0, { 0x200000000, 0x200000000, 0x200000200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xc9010f, 0x0, {  } }, // mwait
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xf6, 0x0, { 0x1000040 } }, // neg
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xf7, 0x0, { 0x10000080 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xf7, 0x0, { 0x80000100 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xf7, 0x0, { 0x200000200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x90, 0x0, {  } }, // nop
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x1f0f, 0x0, { 0x10000080 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x1f0f, 0x0, { 0x80000100 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0xf6, 0x0, { 0x1000040 } }, // not
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0xf7, 0x0, { 0x10000080 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0xf7, 0x0, { 0x80000100 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0xf7, 0x0, { 0x200000200 } },
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xc, 0x0, { 0x4000000, 0x2 } }, // or
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xd, 0x66, { 0x20000000, 0x4 } },
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xd, 0x0, { 0x100000000, 0x8 } },
+	{ 0, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xd, 0x0, { 0x400000000, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 2, 0x80, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x8, 1, 0, 0, 2, 0x81, 0x66, { 0x10000080, 0x4 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 2, 0x81, 0x0, { 0x80000100, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 2, 0x81, 0x0, { 0x200000200, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 1, 2, 0x83, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 1, 2, 0x83, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x8, 1, 0, 1, 2, 0x83, 0x0, { 0x200000200, 0x2 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x8, 0x0, { 0x1000040, 0x1000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x8, 0x0, { 0x1000040, 0x2000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x9, 0x66, { 0x10000080, 0x10000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x9, 0x0, { 0x80000100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x9, 0x0, { 0x200000200, 0x200000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xa, 0x0, { 0x1000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xa, 0x0, { 0x2000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb, 0x66, { 0x10000000, 0x10000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x560f, 0x66, { 0x40000000000, 0x40000000400 } }, // orpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x56, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vorpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x56, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x560f, 0x0, { 0x40000000000, 0x40000000400 } }, // orps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 3, 0x56, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vorps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 3, 0x56, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 0, 0, 0, 0, 1, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xe6, 0x0, { 0x2, 0x4000000 } }, // out
+	{ 0, 0, 0, 0, 1, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xe7, 0x66, { 0x2, 0x20000000 } },
+	{ 0, 0, 0, 0, 1, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xe7, 0x0, { 0x2, 0x100000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xee, 0x0, { 0x40000000, 0x4000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xef, 0x66, { 0x40000000, 0x20000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xef, 0x0, { 0x40000000, 0x100000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x6e, 0x0, { 0x40000000, 0x40 } }, // outs
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x6f, 0x66, { 0x40000000, 0x80 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x6f, 0x0, { 0x40000000, 0x100 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x6e, 0x0, {  } }, // outsb
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x6f, 0x66, {  } }, // outsw
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x6f, 0x0, {  } }, // outsd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x1c380f, 0x0, { 0x10000, 0x10200 } }, // pabsb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x1c380f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x1d380f, 0x0, { 0x10000, 0x10200 } }, // pabsw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x1d380f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x1e380f, 0x0, { 0x10000, 0x10200 } }, // pabsd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x1e380f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x1c, 0x0, { 0x40000000000, 0x40000000400 } }, // vpabsb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x1c, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x1d, 0x0, { 0x40000000000, 0x40000000400 } }, // vpabsw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x1d, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x1e, 0x0, { 0x40000000000, 0x40000000400 } }, // vpabsd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x1e, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x630f, 0x0, { 0x10000, 0x10200 } }, // packsswb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x630f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x6b0f, 0x0, { 0x10000, 0x10200 } }, // packssdw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x6b0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x63, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpacksswb
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x63, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x6b, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpackssdw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x6b, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2b380f, 0x66, { 0x40000000000, 0x40000000400 } }, // packusdw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x2b, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpackusdw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x2b, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x670f, 0x0, { 0x10000, 0x10200 } }, // packuswb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x670f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x67, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpackuswb
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x67, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xfc0f, 0x0, { 0x10000, 0x10200 } }, // paddb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xfc0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xfd0f, 0x0, { 0x10000, 0x10200 } }, // paddw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xfd0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xfe0f, 0x0, { 0x10000, 0x10200 } }, // paddd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xfe0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xfc, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpaddb
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xfc, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xfd, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpaddw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xfd, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xfe, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpaddd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xfe, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd40f, 0x0, { 0x10000, 0x10200 } }, // paddq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd40f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xd4, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpaddq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xd4, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xec0f, 0x0, { 0x10000, 0x10200 } }, // paddsb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xec0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xed0f, 0x0, { 0x10000, 0x10200 } }, // paddsw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xed0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xec, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpaddsb
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xec, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xed, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpaddsw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xed, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xdc0f, 0x0, { 0x10000, 0x10200 } }, // paddusb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xdc0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xdd0f, 0x0, { 0x10000, 0x10200 } }, // paddusw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xdd0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xdc, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpaddusb
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xdc, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xdd, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpaddusw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xdd, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 0, 0, 0, 3, 0xf3a0f, 0x0, { 0x10000, 0x10200, 0x2 } }, // palignr
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 0, 0, 0, 3, 0xf3a0f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } },
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 4, 0xf, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400, 0x2 } }, // vpalignr
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 4, 0xf, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800, 0x2 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xdb0f, 0x0, { 0x10000, 0x10200 } }, // pand
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xdb0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xdb, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpand
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xdb, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xdf0f, 0x0, { 0x10000, 0x10200 } }, // pandn
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xdf0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xdf, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpandn
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xdf, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x90, 0xf3, {  } }, // pause
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe00f, 0x0, { 0x10000, 0x10200 } }, // pavgb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe00f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe30f, 0x0, { 0x10000, 0x10200 } }, // pavgw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe30f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xe0, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpavgb
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xe0, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xe3, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpavgw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xe3, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x10380f, 0x66, { 0x40000000000, 0x40000000400, 0x80000000000 } }, // pblendvb
+	{ 3, 1, 0, 2, 0, 4, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 4, 0x4c, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400, 0x40000000000 } }, // vpblendvb
+	{ 3, 1, 0, 2, 0, 4, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 4, 0x4c, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800, 0x100000000000 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0xe3a0f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } }, // pblendw
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 4, 0xe, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400, 0x2 } }, // vpblendw
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 4, 0xe, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800, 0x2 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x443a0f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } }, // pclmulqdq
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 4, 0x44, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400, 0x2 } }, // vpclmulqdq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x740f, 0x0, { 0x10000, 0x10200 } }, // pcmpeqb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x740f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x750f, 0x0, { 0x10000, 0x10200 } }, // pcmpeqw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x750f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x760f, 0x0, { 0x10000, 0x10200 } }, // pcmpeqd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x760f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x74, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpcmpeqb
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x74, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x75, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpcmpeqw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x75, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x76, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpcmpeqd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x76, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x29380f, 0x66, { 0x40000000000, 0x40000000400 } }, // pcmpeqq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x29, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpcmpeqq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x29, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x613a0f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } }, // pcmpestri
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 3, 0x61, 0x0, { 0x40000000000, 0x40000000400, 0x2 } }, // vpcmpestri
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x603a0f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } }, // pcmpestrm
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 3, 0x60, 0x0, { 0x40000000000, 0x40000000400, 0x2 } }, // vpcmpestrm
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x640f, 0x0, { 0x10000, 0x10200 } }, // pcmpgtb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x640f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x650f, 0x0, { 0x10000, 0x10200 } }, // pcmpgtw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x650f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x660f, 0x0, { 0x10000, 0x10200 } }, // pcmpgtd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x660f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x64, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpcmpgtb
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x64, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x65, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpcmpgtw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x65, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x66, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpcmpgtd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x66, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x37380f, 0x66, { 0x40000000000, 0x40000000400 } }, // pcmpgtq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x37, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpcmpgtq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x37, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x633a0f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } }, // pcmpistri
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 3, 0x63, 0x0, { 0x40000000000, 0x40000000400, 0x2 } }, // vpcmpistri
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x623a0f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } }, // pcmpistrm
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 3, 0x62, 0x0, { 0x40000000000, 0x40000000400, 0x2 } }, // vpcmpistrm
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7b, 0x0, 1, 1, 0, 3, 0xf5, 0x0, { 0x80000000, 0x80000000, 0x80000100 } }, // pdep
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfb, 0x0, 1, 1, 0, 3, 0xf5, 0x0, { 0x200000000, 0x200000000, 0x200000200 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7a, 0x0, 1, 1, 0, 3, 0xf5, 0x0, { 0x80000000, 0x80000000, 0x80000100 } }, // pext
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfa, 0x0, 1, 1, 0, 3, 0xf5, 0x0, { 0x200000000, 0x200000000, 0x200000200 } },
+	{ 1, 2, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x143a0f, 0x66, { 0x280000040, 0x40000000000, 0x2 } }, // pextrb
+	{ 1, 2, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x163a0f, 0x66, { 0x80000100, 0x40000000000, 0x2 } }, // pextrd
+	{ 1, 2, 0, 0, 3, 0, 0x48, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x163a0f, 0x66, { 0x200000200, 0x40000000000, 0x2 } }, // pextrq
+	{ 1, 2, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 3, 0x14, 0x0, { 0x280000040, 0x40000000000, 0x2 } }, // vpextrb
+	{ 1, 2, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 3, 0x16, 0x0, { 0x80000100, 0x40000000000, 0x2 } }, // vpextrd
+	{ 1, 2, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0xf9, 0x0, 1, 1, 0, 3, 0x16, 0x0, { 0x200000200, 0x40000000000, 0x2 } }, // vpextrq
+	{ 2, 1, 0, 0, 3, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0xc50f, 0x0, { 0x280000000, 0x10000, 0x2 } }, // pextrw
+	{ 2, 1, 0, 0, 3, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 1, 3, 0xc50f, 0x66, { 0x280000000, 0x40000000000, 0x2 } },
+	{ 1, 2, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x153a0f, 0x66, { 0x280000080, 0x40000000000, 0x2 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 1, 3, 0xc5, 0x0, { 0x280000000, 0x40000000000, 0x2 } }, // vpextrw
+	{ 1, 2, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 3, 0x15, 0x0, { 0x280000080, 0x40000000000, 0x2 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x1380f, 0x0, { 0x10000, 0x10200 } }, // phaddw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x1380f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2380f, 0x0, { 0x10000, 0x10200 } }, // phaddd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2380f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x1, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vphaddw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x1, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x2, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vphaddd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x2, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3380f, 0x0, { 0x10000, 0x10200 } }, // phaddsw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3380f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x3, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vphaddsw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x3, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x41380f, 0x66, { 0x40000000000, 0x40000000400 } }, // phminposuw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x41, 0x0, { 0x40000000000, 0x40000000400 } }, // vphminposuw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5380f, 0x0, { 0x10000, 0x10200 } }, // phsubw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5380f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x6380f, 0x0, { 0x10000, 0x10200 } }, // phsubd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x6380f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x5, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vphsubw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x5, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x6, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vphsubd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x6, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x7380f, 0x0, { 0x10000, 0x10200 } }, // phsubsw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x7380f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x7, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vphsubsw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x7, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x203a0f, 0x66, { 0x40000000000, 0x80000040, 0x2 } }, // pinsrb
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x223a0f, 0x66, { 0x40000000000, 0x80000100, 0x2 } }, // pinsrd
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 4, 0x20, 0x0, { 0x40000000000, 0x40000000000, 0x80000040, 0x2 } }, // vpinsrb
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 4, 0x22, 0x0, { 0x40000000000, 0x40000000000, 0x80000100, 0x2 } }, // vpinsrd
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0xf9, 0x0, 1, 1, 0, 4, 0x22, 0x0, { 0x40000000000, 0x40000000000, 0x200000200, 0x2 } }, // vpinsrq
+	{ 2, 1, 0, 0, 3, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0xc40f, 0x0, { 0x10000, 0x80000080, 0x2 } }, // pinsrw
+	{ 2, 1, 0, 0, 3, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0xc40f, 0x66, { 0x40000000000, 0x80000080, 0x2 } },
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 4, 0xc4, 0x0, { 0x40000000000, 0x40000000000, 0x80000080, 0x2 } }, // vpinsrw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4380f, 0x0, { 0x10000, 0x10200 } }, // pmaddubsw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x4380f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x4, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpmaddubsw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x4, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf50f, 0x0, { 0x10000, 0x10200 } }, // pmaddwd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf50f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xf5, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpmaddwd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xf5, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3c380f, 0x66, { 0x40000000000, 0x40000000400 } }, // pmaxsb
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x3c, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpmaxsb
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x3c, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3d380f, 0x66, { 0x40000000000, 0x40000000400 } }, // pmaxsd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x3d, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpmaxsd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x3d, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xee0f, 0x0, { 0x10000, 0x10200 } }, // pmaxsw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xee0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xee, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpmaxsw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xee, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xde0f, 0x0, { 0x10000, 0x10200 } }, // pmaxub
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xde0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xde, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpmaxub
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xde, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3f380f, 0x66, { 0x40000000000, 0x40000000400 } }, // pmaxud
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x3f, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpmaxud
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x3f, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3e380f, 0x66, { 0x40000000000, 0x40000000400 } }, // pmaxuw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x3e, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpmaxuw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x3e, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x38380f, 0x66, { 0x40000000000, 0x40000000400 } }, // pminsb
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x38, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpminsb
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x38, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x39380f, 0x66, { 0x40000000000, 0x40000000400 } }, // pminsd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x39, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpminsd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x39, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xea0f, 0x0, { 0x10000, 0x10200 } }, // pminsw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xea0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xea, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpminsw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xda0f, 0x0, { 0x10000, 0x10200 } }, // pminub
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xda0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xda, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpminub
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xda, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3b380f, 0x66, { 0x40000000000, 0x40000000400 } }, // pminud
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x3b, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpminud
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x3b, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3a380f, 0x66, { 0x40000000000, 0x40000000400 } }, // pminuw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x3a, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpminuw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x3a, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd70f, 0x0, { 0x280000000, 0x10000 } }, // pmovmskb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd70f, 0x66, { 0x280000000, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0xd7, 0x0, { 0x280000000, 0x40000000000 } }, // vpmovmskb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 2, 0xd7, 0x0, { 0x280000000, 0x100000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2038, 0x66, { 0x40000000000, 0x40000000200 } }, // pmovsxbw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2138, 0x66, { 0x40000000000, 0x40000000100 } }, // pmovsxbd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2238, 0x66, { 0x40000000000, 0x40000000080 } }, // pmovsxbq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2338, 0x66, { 0x40000000000, 0x40000000200 } }, // pmovsxwd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2438, 0x66, { 0x40000000000, 0x40000000100 } }, // pmovsxwq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2538, 0x66, { 0x40000000000, 0x40000000200 } }, // pmovsxdq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x20, 0x0, { 0x40000000000, 0x40000000200 } }, // vpmovsxbw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x20, 0x0, { 0x100000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x21, 0x0, { 0x40000000000, 0x40000000100 } }, // vpmovsxbd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x21, 0x0, { 0x100000000000, 0x40000000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x22, 0x0, { 0x40000000000, 0x40000000080 } }, // vpmovsxbq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x22, 0x0, { 0x100000000000, 0x40000000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x23, 0x0, { 0x40000000000, 0x40000000200 } }, // vpmovsxwd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x23, 0x0, { 0x100000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x24, 0x0, { 0x40000000000, 0x40000000100 } }, // vpmovsxwq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x24, 0x0, { 0x100000000000, 0x40000000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x25, 0x0, { 0x40000000000, 0x40000000200 } }, // vpmovsxdq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x25, 0x0, { 0x100000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3038, 0x66, { 0x40000000000, 0x40000000200 } }, // pmovzxbw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3138, 0x66, { 0x40000000000, 0x40000000100 } }, // pmovzxbd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3238, 0x66, { 0x40000000000, 0x40000000080 } }, // pmovzxbq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3338, 0x66, { 0x40000000000, 0x40000000200 } }, // pmovzxwd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3438, 0x66, { 0x40000000000, 0x40000000100 } }, // pmovzxwq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x3538, 0x66, { 0x40000000000, 0x40000000200 } }, // pmovzxdq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x30, 0x0, { 0x40000000000, 0x40000000200 } }, // vpmovzxbw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x30, 0x0, { 0x100000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x31, 0x0, { 0x40000000000, 0x40000000100 } }, // vpmovzxbd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x31, 0x0, { 0x100000000000, 0x40000000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x32, 0x0, { 0x40000000000, 0x40000000080 } }, // vpmovzxbq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x32, 0x0, { 0x100000000000, 0x40000000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x33, 0x0, { 0x40000000000, 0x40000000200 } }, // vpmovzxwd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x33, 0x0, { 0x100000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x34, 0x0, { 0x40000000000, 0x40000000100 } }, // vpmovzxwq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x34, 0x0, { 0x100000000000, 0x40000000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x35, 0x0, { 0x40000000000, 0x40000000200 } }, // vpmovzxdq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x35, 0x0, { 0x100000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x28380f, 0x66, { 0x40000000000, 0x40000000400 } }, // pmuldq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x28, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpmuldq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x28, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb380f, 0x0, { 0x10000, 0x10200 } }, // pmulhrsw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb380f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xb, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpmulhrsw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0xb, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe40f, 0x0, { 0x10000, 0x10200 } }, // pmulhuw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe40f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xe4, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpmulhuw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xe4, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe50f, 0x0, { 0x10000, 0x10200 } }, // pmulhw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe50f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xe5, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpmulhw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xe5, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x40380f, 0x66, { 0x40000000000, 0x40000000400 } }, // pmulld
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x40, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpmulld
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x40, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd50f, 0x0, { 0x10000, 0x10200 } }, // pmullw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd50f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xd5, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpmullw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xd5, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf40f, 0x0, { 0x10000, 0x10200 } }, // pmuludq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf40f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xf4, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpmuludq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xf4, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x8f, 0x0, { 0x10000080 } }, // pop
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x8f, 0x0, { 0x200000200 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 1, 0x58, 0x66, { 0x10000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 1, 1, 0x58, 0x0, { 0x200000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa10f, 0x66, { 0x4000000000, 0x20000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xa10f, 0x0, { 0x4000000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa90f, 0x66, { 0x8000000000, 0x20000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xa90f, 0x0, { 0x8000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 2, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb80f, 0xf366, { 0x10000000, 0x10000080 } }, // popcnt
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb80f, 0xf3, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xb80f, 0xf3, { 0x200000000, 0x200000200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x9d, 0x66, {  } }, // popf
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x9d, 0x0, {  } }, // popfq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xeb0f, 0x0, { 0x10000, 0x10200 } }, // por
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xeb0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xeb, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpor
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xeb, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0x180f, 0x0, { 0x40 } }, // prefetcht0
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0x180f, 0x0, { 0x40 } }, // prefetcht1
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0x180f, 0x0, { 0x40 } }, // prefetcht2
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x180f, 0x0, { 0x40 } }, // prefetchnta
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf60f, 0x0, { 0x10000, 0x10200 } }, // psadbw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf60f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xf6, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsadbw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xf6, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x380f, 0x0, { 0x10000, 0x10200 } }, // pshufb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x380f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x0, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpshufb
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x0, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x700f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } }, // pshufd
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x70, 0x0, { 0x40000000000, 0x40000000400, 0x2 } }, // vpshufd
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x70, 0x0, { 0x100000000000, 0x100000000800, 0x2 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x700f, 0xf3, { 0x40000000000, 0x40000000400, 0x2 } }, // pshufhw
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 3, 0x70, 0x0, { 0x40000000000, 0x40000000400, 0x2 } }, // vpshufhw
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x81, 0x7e, 0x0, 1, 1, 0, 3, 0x70, 0x0, { 0x100000000000, 0x100000000800, 0x2 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x700f, 0xf2, { 0x40000000000, 0x40000000400, 0x2 } }, // pshuflw
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 3, 0x70, 0x0, { 0x40000000000, 0x40000000400, 0x2 } }, // vpshuflw
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x81, 0x7f, 0x0, 1, 1, 0, 3, 0x70, 0x0, { 0x100000000000, 0x100000000800, 0x2 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x700f, 0x0, { 0x10000, 0x10200, 0x2 } }, // pshufw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x8380f, 0x0, { 0x10000, 0x10200 } }, // psignb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x8380f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x9380f, 0x0, { 0x10000, 0x10200 } }, // psignw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x9380f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xa380f, 0x0, { 0x10000, 0x10200 } }, // psignd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xa380f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x8, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsignb
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x9, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsignw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xa, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsignd
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 1, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0x730f, 0x66, { 0x40000000000, 0x2 } }, // pslldq
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x1, 0x79, 0x38, 1, 0, 0, 3, 0x73, 0x0, { 0x40000000000, 0x40000000000, 0x2 } }, // vpslldq
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x81, 0x7d, 0x38, 1, 0, 0, 3, 0x73, 0x0, { 0x100000000000, 0x100000000000, 0x2 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf10f, 0x0, { 0x10000, 0x10200 } }, // psllw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf10f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 0, 0x0, 0x0, 0x30, 1, 0, 0, 2, 0x710f, 0x0, { 0x10000, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 1, 0x0, 0x0, 0x30, 1, 0, 1, 2, 0x710f, 0x66, { 0x40000000000, 0x2 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf20f, 0x0, { 0x10000, 0x10200 } }, // pslld
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf20f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 0, 0x0, 0x0, 0x30, 1, 0, 0, 2, 0x720f, 0x0, { 0x10000, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 1, 0x0, 0x0, 0x30, 1, 0, 0, 2, 0x720f, 0x66, { 0x40000000000, 0x2 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf30f, 0x0, { 0x10000, 0x10200 } }, // psllq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf30f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 0, 0x0, 0x0, 0x30, 1, 0, 0, 2, 0x730f, 0x0, { 0x10000, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 1, 0x0, 0x0, 0x30, 1, 0, 0, 2, 0x730f, 0x66, { 0x40000000000, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xf1, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsllw
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x1, 0x79, 0x30, 1, 0, 0, 3, 0x71, 0x0, { 0x40000000000, 0x40000000000, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xf1, 0x0, { 0x100000000000, 0x100000000000, 0x40000000400 } },
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x81, 0x7d, 0x30, 1, 0, 0, 3, 0x71, 0x0, { 0x100000000000, 0x100000000000, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xf2, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpslld
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x1, 0x79, 0x30, 1, 0, 0, 3, 0x72, 0x0, { 0x40000000000, 0x40000000000, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xf2, 0x0, { 0x100000000000, 0x100000000000, 0x40000000400 } },
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x81, 0x7d, 0x30, 1, 0, 0, 3, 0x72, 0x0, { 0x100000000000, 0x100000000000, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xf3, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsllq
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x1, 0x79, 0x30, 1, 0, 0, 3, 0x73, 0x0, { 0x40000000000, 0x40000000000, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xf3, 0x0, { 0x100000000000, 0x100000000000, 0x40000000400 } },
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x81, 0x7d, 0x30, 1, 0, 0, 3, 0x73, 0x0, { 0x100000000000, 0x100000000000, 0x2 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe10f, 0x0, { 0x10000, 0x10200 } }, // psraw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe10f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0x710f, 0x0, { 0x10000, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 1, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0x710f, 0x66, { 0x40000000000, 0x2 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe20f, 0x0, { 0x10000, 0x10200 } }, // psrad
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe20f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0x720f, 0x0, { 0x10000, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 1, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0x720f, 0x66, { 0x40000000000, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xe1, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsraw
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x1, 0x79, 0x20, 1, 0, 0, 3, 0x71, 0x0, { 0x40000000000, 0x40000000000, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xe1, 0x0, { 0x100000000000, 0x100000000000, 0x40000000400 } },
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x81, 0x7d, 0x20, 1, 0, 0, 3, 0x71, 0x0, { 0x100000000000, 0x100000000000, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xe2, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsrad
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x1, 0x79, 0x20, 1, 0, 0, 3, 0x72, 0x0, { 0x40000000000, 0x40000000000, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xe2, 0x0, { 0x100000000000, 0x100000000000, 0x40000000400 } },
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x81, 0x7d, 0x20, 1, 0, 0, 3, 0x72, 0x0, { 0x100000000000, 0x100000000000, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 1, 0x0, 0x0, 0x18, 1, 0, 0, 2, 0x730f, 0x66, { 0x40000000000, 0x2 } }, // psrldq
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x1, 0x79, 0x18, 1, 0, 0, 3, 0x73, 0x0, { 0x40000000000, 0x40000000000, 0x2 } }, // vpsrldq
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x81, 0x7d, 0x18, 1, 0, 0, 3, 0x73, 0x0, { 0x100000000000, 0x100000000000, 0x2 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd10f, 0x0, { 0x10000, 0x10200 } }, // psrlw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd10f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0x710f, 0x0, { 0x10000, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 1, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0x710f, 0x66, { 0x40000000000, 0x2 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd20f, 0x0, { 0x10000, 0x10200 } }, // psrld
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd20f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0x720f, 0x0, { 0x10000, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 1, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0x720f, 0x66, { 0x40000000000, 0x2 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd30f, 0x0, { 0x10000, 0x10200 } }, // psrlq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd30f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0x730f, 0x0, { 0x10000, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 2, 1, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0x730f, 0x66, { 0x40000000000, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xd1, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsrlw
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x1, 0x79, 0x10, 1, 0, 0, 3, 0x71, 0x0, { 0x40000000000, 0x40000000000, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xd1, 0x0, { 0x100000000000, 0x100000000000, 0x40000000400 } },
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x81, 0x7d, 0x10, 1, 0, 0, 3, 0x71, 0x0, { 0x100000000000, 0x100000000000, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xd2, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsrld
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x1, 0x79, 0x10, 1, 0, 0, 3, 0x72, 0x0, { 0x40000000000, 0x40000000000, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xd2, 0x0, { 0x100000000000, 0x100000000000, 0x40000000400 } },
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x81, 0x7d, 0x10, 1, 0, 0, 3, 0x72, 0x0, { 0x100000000000, 0x100000000000, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xd3, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsrlq
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x1, 0x79, 0x10, 1, 0, 0, 3, 0x73, 0x0, { 0x40000000000, 0x40000000000, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xd3, 0x0, { 0x100000000000, 0x100000000000, 0x40000000400 } },
+	{ 2, 0, 0, 1, 3, 0, 0x0, 1, 0, 0x81, 0x7d, 0x10, 1, 0, 0, 3, 0x73, 0x0, { 0x100000000000, 0x100000000000, 0x2 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf80f, 0x0, { 0x10000, 0x10200 } }, // psubb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf80f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf90f, 0x0, { 0x10000, 0x10200 } }, // psubw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xf90f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xfa0f, 0x0, { 0x10000, 0x10200 } }, // psubd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xfa0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xf8, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsubb
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xf8, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xf9, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsubw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xf9, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xfa, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsubd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xfa, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xfb0f, 0x0, { 0x10000, 0x10200 } }, // psubq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xfb0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xfb, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsubq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xfb, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe80f, 0x0, { 0x10000, 0x10200 } }, // psubsb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe80f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe90f, 0x0, { 0x10000, 0x10200 } }, // psubsw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xe90f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xe8, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsubsb
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xe8, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xe9, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsubsw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xe9, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd80f, 0x0, { 0x10000, 0x10200 } }, // psubusb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd80f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd90f, 0x0, { 0x10000, 0x10200 } }, // psubusw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xd90f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xd8, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsubusb
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xd8, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xd9, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsubusw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xd9, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x17380f, 0x66, { 0x40000000000, 0x40000000400 } }, // ptest
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x17, 0x0, { 0x40000000000, 0x40000000400 } }, // vptest
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x17, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x680f, 0x0, { 0x10000, 0x10200 } }, // punpckhbw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x680f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x690f, 0x0, { 0x10000, 0x10200 } }, // punpckhwd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x690f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x6a0f, 0x0, { 0x10000, 0x10200 } }, // punpckhdq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x6a0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x6d0f, 0x66, { 0x40000000000, 0x40000000400 } }, // punpckhqdq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x68, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpunpckhbw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x68, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x69, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpunpckhwd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x69, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x6a, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpunpckhdq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x6a, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x6d, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpunpckhqdq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x6d, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x600f, 0x0, { 0x10000, 0x10100 } }, // punpcklbw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x600f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x610f, 0x0, { 0x10000, 0x10100 } }, // punpcklwd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x610f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x620f, 0x0, { 0x10000, 0x10100 } }, // punpckldq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x620f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x6c0f, 0x66, { 0x40000000000, 0x40000000400 } }, // punpcklqdq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x60, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpunpcklbw
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x60, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x61, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpunpcklwd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x61, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x62, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpunpckldq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x62, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x6c, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpunpcklqdq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x6c, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xff, 0x0, { 0x10000080 } }, // push
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xff, 0x0, { 0x200000200 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 1, 0x50, 0x66, { 0x10000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 1, 1, 0x50, 0x0, { 0x200000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xa00f, 0x0, { 0x4000000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xa80f, 0x0, { 0x8000000000 } },
+	{ 0, 0, 0, 0, 1, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x6a, 0x0, { 0x2 } }, // pushq
+	{ 0, 0, 0, 0, 1, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x68, 0x66, { 0x4 } },
+	{ 0, 0, 0, 0, 1, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x68, 0x0, { 0x8 } },
+	{ 0, 0, 0, 0, 1, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x6a, 0x66, { 0x2 } }, // pushw
+	{ 0, 0, 0, 0, 1, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x68, 0x66, { 0x4 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x9c, 0x66, {  } }, // pushf
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x9c, 0x0, {  } }, // pushfq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xef0f, 0x0, { 0x10000, 0x10200 } }, // pxor
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xef0f, 0x66, { 0x40000000000, 0x40000000400 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0xef, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpxor
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0xef, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0xd0, 0x0, { 0x1000040, 0x2000000000000 } }, // rcl
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0xd2, 0x0, { 0x1000040, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0xc0, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0xd1, 0x0, { 0x10000080, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0xd3, 0x0, { 0x10000080, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0xc1, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0xd1, 0x0, { 0x80000100, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0xd1, 0x0, { 0x200000200, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0xd3, 0x0, { 0x80000100, 0x8000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0xd3, 0x0, { 0x200000200, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0xc1, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x10, 1, 0, 0, 2, 0xc1, 0x0, { 0x200000200, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 2, 0xd0, 0x0, { 0x1000040, 0x2000000000000 } }, // rcr
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 2, 0xd2, 0x0, { 0x1000040, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 2, 0xc0, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 2, 0xd1, 0x0, { 0x10000080, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 2, 0xd3, 0x0, { 0x10000080, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 2, 0xc1, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 2, 0xd1, 0x0, { 0x80000100, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 2, 0xd1, 0x0, { 0x200000200, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 2, 0xd3, 0x0, { 0x80000100, 0x8000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 2, 0xd3, 0x0, { 0x200000200, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 2, 0xc1, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 2, 0xc1, 0x0, { 0x200000200, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xd0, 0x0, { 0x1000040, 0x2000000000000 } }, // rol
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xd2, 0x0, { 0x1000040, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xc0, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xd1, 0x0, { 0x10000080, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xd3, 0x0, { 0x10000080, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xc1, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xd1, 0x0, { 0x80000100, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xd1, 0x0, { 0x200000200, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xd3, 0x0, { 0x80000100, 0x8000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xd3, 0x0, { 0x200000200, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xc1, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xc1, 0x0, { 0x200000200, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 2, 0xd0, 0x0, { 0x1000040, 0x2000000000000 } }, // ror
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 2, 0xd2, 0x0, { 0x1000040, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 2, 0xc0, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 2, 0xd1, 0x0, { 0x10000080, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 2, 0xd3, 0x0, { 0x10000080, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 2, 0xc1, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 2, 0xd1, 0x0, { 0x80000100, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 2, 0xd1, 0x0, { 0x200000200, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 2, 0xd3, 0x0, { 0x80000100, 0x8000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 2, 0xd3, 0x0, { 0x200000200, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 2, 0xc1, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x8, 1, 0, 0, 2, 0xc1, 0x0, { 0x200000200, 0x2 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x530f, 0x0, { 0x40000000000, 0x40000000400 } }, // rcpps
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 2, 0x53, 0x0, { 0x40000000000, 0x40000000400 } }, // vrcpps
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 2, 0x53, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x530f, 0xf3, { 0x40000000000, 0x40000000100 } }, // rcpss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 3, 0x53, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vrcpss
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xae0f, 0xf3, { 0x80000000 } }, // rdfsbase
+	{ 1, 0, 0, 0, 0, 0, 0x48, 2, 1, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xae0f, 0xf3, { 0x200000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xae0f, 0xf3, { 0x80000000 } }, // rdgsbase
+	{ 1, 0, 0, 0, 0, 0, 0x48, 2, 1, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xae0f, 0xf3, { 0x200000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x320f, 0x0, {  } }, // rdmsr
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x330f, 0x0, {  } }, // rdpmc
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xc70f, 0x66, { 0x10000000 } }, // rdrand
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xc70f, 0x0, { 0x80000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xc70f, 0x0, { 0x200000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x310f, 0x0, {  } }, // rdtsc
+	{ 0, 0, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf9010f, 0x0, {  } }, // rdtscp
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0x6c, 0xf3, { 0x40, 0x40000000 } }, // rep ins
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x6c, 0xf3, { 0x40, 0x40000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 2, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0x6d, 0xf366, { 0x80, 0x40000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0x6d, 0xf3, { 0x100, 0x40000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x6d, 0xf3, { 0x200, 0x40000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0xa4, 0xf3, { 0x40, 0x40 } }, // rep movs
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa4, 0xf3, { 0x40, 0x40 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 2, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0xa5, 0xf366, { 0x80, 0x80 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0xa5, 0xf3, { 0x100, 0x100 } },
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa5, 0xf3, { 0x200, 0x200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0x6e, 0xf3, { 0x40000000, 0x40 } }, // rep outs
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x6e, 0xf3, { 0x40000000, 0x40 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 2, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0x6f, 0xf366, { 0x40000000, 0x80 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0x6f, 0xf3, { 0x40000000, 0x100 } },
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x6f, 0xf3, { 0x40000000, 0x200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 1, 0xac, 0xf3, { 0x4000000 } }, // rep lods
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xac, 0xf3, { 0x4000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 2, 0x0, 0x0, 0x0, 0, 0, 1, 1, 0xad, 0xf366, { 0x20000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 1, 0xad, 0xf3, { 0x100000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xad, 0xf3, { 0x400000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 1, 0xaa, 0xf3, { 0x40 } }, // rep stos
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xaa, 0xf3, { 0x40 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 2, 0x0, 0x0, 0x0, 0, 0, 1, 1, 0xab, 0xf366, { 0x80 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 1, 0xab, 0xf3, { 0x100 } },
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xab, 0xf3, { 0x200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0xa6, 0xf3, { 0x40, 0x40 } }, // repe cmps
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa6, 0xf3, { 0x40, 0x40 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 2, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0xa7, 0xf366, { 0x80, 0x80 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0xa7, 0xf3, { 0x100, 0x100 } },
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa7, 0xf3, { 0x200, 0x200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 1, 0xae, 0xf3, { 0x40 } }, // repe scas
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xae, 0xf3, { 0x40 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 2, 0x0, 0x0, 0x0, 0, 0, 1, 1, 0xaf, 0xf366, { 0x80 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 1, 0xaf, 0xf3, { 0x100 } },
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xaf, 0xf3, { 0x200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0xa6, 0xf2, { 0x40, 0x40 } }, // repne cmps
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa6, 0xf2, { 0x40, 0x40 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 2, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0xa7, 0xf266, { 0x80, 0x80 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 2, 0xa7, 0xf2, { 0x100, 0x100 } },
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa7, 0xf2, { 0x200, 0x200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 1, 0xae, 0xf2, { 0x40 } }, // repne scas
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xae, 0xf2, { 0x40 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 2, 0x0, 0x0, 0x0, 0, 0, 1, 1, 0xaf, 0xf266, { 0x80 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 1, 1, 0xaf, 0xf2, { 0x100 } },
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xaf, 0xf2, { 0x200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xc3, 0x0, {  } }, // ret
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xcb, 0x0, { 0x80000 } },
+	{ 0, 0, 0, 0, 1, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xc2, 0x0, { 0x4 } },
+	{ 0, 0, 0, 0, 1, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xca, 0x0, { 0x4, 0x80000 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x7b, 0x0, 1, 1, 0, 3, 0xf0, 0x0, { 0x80000000, 0x80000100, 0x2 } }, // rorx
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0xfb, 0x0, 1, 1, 0, 3, 0xf0, 0x0, { 0x200000000, 0x200000200, 0x2 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x93a0f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } }, // roundpd
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 3, 0x9, 0x0, { 0x40000000000, 0x40000000400, 0x2 } }, // vroundpd
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 3, 0x9, 0x0, { 0x100000000000, 0x100000000800, 0x2 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0x83a0f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } }, // roundps
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 3, 0x8, 0x0, { 0x40000000000, 0x40000000400, 0x2 } }, // vroundps
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 3, 0x8, 0x0, { 0x100000000000, 0x100000000800, 0x2 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0xb3a0f, 0x66, { 0x40000000000, 0x40000000200, 0x2 } }, // roundsd
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 4, 0xb, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200, 0x2 } }, // vroundsd
+	{ 2, 1, 0, 0, 3, 0, 0x0, 3, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0xa3a0f, 0x66, { 0x40000000000, 0x40000000100, 0x2 } }, // roundss
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 0, 0, 0, 4, 0xa, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100, 0x2 } }, // vroundss
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x520f, 0x0, { 0x40000000000, 0x40000000400 } }, // rsqrtps
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 2, 0x52, 0x0, { 0x40000000000, 0x40000000400 } }, // vrsqrtps
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 2, 0x52, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x520f, 0xf3, { 0x40000000000, 0x40000000100 } }, // rsqrtss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 3, 0x52, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vrsqrtss
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x9e, 0x0, {  } }, // sahf
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xd0, 0x0, { 0x1000040, 0x2000000000000 } }, // sal
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xd2, 0x0, { 0x1000040, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xc0, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xd1, 0x0, { 0x10000080, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xd3, 0x0, { 0x10000080, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xc1, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xd1, 0x0, { 0x80000100, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xd1, 0x0, { 0x200000200, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xd3, 0x0, { 0x80000100, 0x8000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xd3, 0x0, { 0x200000200, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xc1, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xc1, 0x0, { 0x200000200, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0xd0, 0x0, { 0x1000040, 0x2000000000000 } }, // sar
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0xd2, 0x0, { 0x1000040, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0xc0, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0xd1, 0x0, { 0x10000080, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0xd3, 0x0, { 0x10000080, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0xc1, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0xd1, 0x0, { 0x80000100, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0xd1, 0x0, { 0x200000200, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0xd3, 0x0, { 0x80000100, 0x8000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0xd3, 0x0, { 0x200000200, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0xc1, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x38, 1, 0, 0, 2, 0xc1, 0x0, { 0x200000200, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xd0, 0x0, { 0x1000040, 0x2000000000000 } }, // shl
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xd2, 0x0, { 0x1000040, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xc0, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xd1, 0x0, { 0x10000080, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xd3, 0x0, { 0x10000080, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xc1, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xd1, 0x0, { 0x80000100, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xd1, 0x0, { 0x200000200, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xd3, 0x0, { 0x80000100, 0x8000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xd3, 0x0, { 0x200000200, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xc1, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x20, 1, 0, 0, 2, 0xc1, 0x0, { 0x200000200, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0xd0, 0x0, { 0x1000040, 0x2000000000000 } }, // shr
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0xd2, 0x0, { 0x1000040, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0xc0, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0xd1, 0x0, { 0x10000080, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0xd3, 0x0, { 0x10000080, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0xc1, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0xd1, 0x0, { 0x80000100, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0xd1, 0x0, { 0x200000200, 0x2000000000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0xd3, 0x0, { 0x80000100, 0x8000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0xd3, 0x0, { 0x200000200, 0x8000000 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0xc1, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0xc1, 0x0, { 0x200000200, 0x2 } },
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0x7a, 0x0, 1, 1, 0, 3, 0xf7, 0x0, { 0x80000000, 0x80000100, 0x80000000 } }, // sarx
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0xfa, 0x0, 1, 1, 0, 3, 0xf7, 0x0, { 0x200000000, 0x200000200, 0x200000000 } },
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xf7, 0x0, { 0x80000000, 0x80000100, 0x80000000 } }, // shlx
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xf7, 0x0, { 0x200000000, 0x200000200, 0x200000000 } },
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0x7b, 0x0, 1, 1, 0, 3, 0xf7, 0x0, { 0x80000000, 0x80000100, 0x80000000 } }, // shrx
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0xfb, 0x0, 1, 1, 0, 3, 0xf7, 0x0, { 0x200000000, 0x200000200, 0x200000000 } },
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x1c, 0x0, { 0x4000000, 0x2 } }, // sbb
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x1d, 0x66, { 0x20000000, 0x4 } },
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x1d, 0x0, { 0x100000000, 0x8 } },
+	{ 0, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x1d, 0x0, { 0x400000000, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 2, 0x80, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x18, 1, 0, 0, 2, 0x81, 0x66, { 0x10000080, 0x4 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 2, 0x81, 0x0, { 0x80000100, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x18, 1, 0, 0, 2, 0x81, 0x0, { 0x200000200, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 1, 2, 0x83, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x18, 1, 0, 1, 2, 0x83, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x18, 1, 0, 1, 2, 0x83, 0x0, { 0x200000200, 0x2 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x18, 0x0, { 0x1000040, 0x1000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x18, 0x0, { 0x1000040, 0x2000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x19, 0x66, { 0x10000080, 0x10000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x19, 0x0, { 0x80000100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x19, 0x0, { 0x200000200, 0x200000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x1a, 0x0, { 0x1000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x1a, 0x0, { 0x2000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x1b, 0x66, { 0x10000000, 0x10000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x1b, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x1b, 0x0, { 0x200000000, 0x200000200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xae, 0x0, { 0x40 } }, // scas
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xaf, 0x66, { 0x80 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xaf, 0x0, { 0x100 } },
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xaf, 0x0, { 0x200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xae, 0x0, {  } }, // scasb
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xaf, 0x66, {  } }, // scasw
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xaf, 0x0, {  } }, // scasd
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xaf, 0x0, {  } }, // scasq
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x970f, 0x0, { 0x1000040 } }, // seta
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x930f, 0x0, { 0x1000040 } }, // setae
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x920f, 0x0, { 0x1000040 } }, // setb
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x960f, 0x0, { 0x1000040 } }, // setbe
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x920f, 0x0, { 0x1000040 } }, // setc
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x940f, 0x0, { 0x1000040 } }, // sete
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x9f0f, 0x0, { 0x1000040 } }, // setg
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x9d0f, 0x0, { 0x1000040 } }, // setge
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x9c0f, 0x0, { 0x1000040 } }, // setl
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x9e0f, 0x0, { 0x1000040 } }, // setle
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x960f, 0x0, { 0x1000040 } }, // setna
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x920f, 0x0, { 0x1000040 } }, // setnae
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x930f, 0x0, { 0x1000040 } }, // setnb
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x970f, 0x0, { 0x1000040 } }, // setnbe
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x930f, 0x0, { 0x1000040 } }, // setnc
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x950f, 0x0, { 0x1000040 } }, // setne
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x9e0f, 0x0, { 0x1000040 } }, // setng
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x9c0f, 0x0, { 0x1000040 } }, // setnge
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x9d0f, 0x0, { 0x1000040 } }, // setnl
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x9f0f, 0x0, { 0x1000040 } }, // setnle
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x910f, 0x0, { 0x1000040 } }, // setno
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x9b0f, 0x0, { 0x1000040 } }, // setnp
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x990f, 0x0, { 0x1000040 } }, // setns
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x950f, 0x0, { 0x1000040 } }, // setnz
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x900f, 0x0, { 0x1000040 } }, // seto
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x9a0f, 0x0, { 0x1000040 } }, // setp
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x9a0f, 0x0, { 0x1000040 } }, // setpe
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x9b0f, 0x0, { 0x1000040 } }, // setpo
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x980f, 0x0, { 0x1000040 } }, // sets
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x940f, 0x0, { 0x1000040 } }, // setz
+	{ 0, 0, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf8ae0f, 0x0, {  } }, // sfence
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0x10f, 0x0, { 0x1fc0 } }, // sgdt
+	{ 1, 2, 0, 0, 3, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 0, 0, 0, 3, 0xa40f, 0x66, { 0x10000080, 0x10000000, 0x2 } }, // shld
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 0, 0, 0, 3, 0xa50f, 0x66, { 0x10000080, 0x10000000, 0x8000000 } },
+	{ 1, 2, 0, 0, 3, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 3, 0xa40f, 0x0, { 0x80000100, 0x80000000, 0x2 } },
+	{ 1, 2, 0, 0, 3, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 3, 0xa40f, 0x0, { 0x200000200, 0x200000000, 0x2 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 3, 0xa50f, 0x0, { 0x80000100, 0x80000000, 0x8000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 3, 0xa50f, 0x0, { 0x200000200, 0x200000000, 0x8000000 } },
+	{ 1, 2, 0, 0, 3, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 0, 0, 0, 3, 0xac0f, 0x66, { 0x10000080, 0x10000000, 0x2 } }, // shrd
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 0, 0, 0, 3, 0xad0f, 0x66, { 0x10000080, 0x10000000, 0x8000000 } },
+	{ 1, 2, 0, 0, 3, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 3, 0xac0f, 0x0, { 0x80000100, 0x80000000, 0x2 } },
+	{ 1, 2, 0, 0, 3, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 3, 0xac0f, 0x0, { 0x200000200, 0x200000000, 0x2 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 3, 0xad0f, 0x0, { 0x80000100, 0x80000000, 0x8000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 3, 0xad0f, 0x0, { 0x200000200, 0x200000000, 0x8000000 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0xc60f, 0x66, { 0x40000000000, 0x40000000400, 0x2 } }, // shufpd
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 4, 0xc6, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400, 0x2 } }, // vshufpd
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 4, 0xc6, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800, 0x2 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 3, 0xc60f, 0x0, { 0x40000000000, 0x40000000400, 0x2 } }, // shufps
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 4, 0xc6, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400, 0x2 } }, // vshufps
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 4, 0xc6, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0x10f, 0x0, { 0x1fc0 } }, // sidt
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xf, 0x0, { 0x10000080 } }, // sldt
+	{ 1, 0, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 0, 0, 1, 0xf, 0x0, { 0x200000080 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0x10f, 0x0, { 0x10000080 } }, // smsw
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0x10f, 0x0, { 0x80000080 } },
+	{ 1, 0, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0x10f, 0x0, { 0x200000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x510f, 0x66, { 0x40000000000, 0x40000000400 } }, // sqrtpd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0x51, 0x0, { 0x40000000000, 0x40000000400 } }, // vsqrtpd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 2, 0x51, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x510f, 0x0, { 0x40000000000, 0x40000000400 } }, // sqrtps
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 2, 0x51, 0x0, { 0x40000000000, 0x40000000400 } }, // vsqrtps
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 2, 0x51, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x510f, 0xf2, { 0x40000000000, 0x40000000200 } }, // sqrtsd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 3, 0x51, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vsqrtsd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x510f, 0xf3, { 0x40000000000, 0x40000000100 } }, // sqrtss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 0, 0, 0, 3, 0x51, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vsqrtss
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf9, 0x0, {  } }, // stc
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xfd, 0x0, {  } }, // std
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xfb, 0x0, {  } }, // sti
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xae0f, 0x0, { 0x100 } }, // stmxcsr
+	{ 1, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x18, 1, 0, 0, 1, 0xae, 0x0, { 0x100 } }, // vstmxcsr
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xaa, 0x0, { 0x40 } }, // stos
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xab, 0x66, { 0x80 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xab, 0x0, { 0x100 } },
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xab, 0x0, { 0x200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xaa, 0x0, {  } }, // stosb
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xab, 0x66, {  } }, // stosw
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xab, 0x0, {  } }, // stosd
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xab, 0x0, {  } }, // stosq
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x8, 1, 0, 0, 1, 0xf, 0x0, { 0x10000080 } }, // str
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x2c, 0x0, { 0x4000000, 0x2 } }, // sub
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x2d, 0x66, { 0x20000000, 0x4 } },
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x2d, 0x0, { 0x100000000, 0x8 } },
+	{ 0, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x2d, 0x0, { 0x400000000, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0x80, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0x81, 0x66, { 0x10000080, 0x4 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0x81, 0x0, { 0x80000100, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x28, 1, 0, 0, 2, 0x81, 0x0, { 0x200000200, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 1, 2, 0x83, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x28, 1, 0, 1, 2, 0x83, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x28, 1, 0, 1, 2, 0x83, 0x0, { 0x200000200, 0x2 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x28, 0x0, { 0x1000040, 0x1000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x28, 0x0, { 0x1000040, 0x2000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x29, 0x66, { 0x10000080, 0x10000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x29, 0x0, { 0x80000100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x29, 0x0, { 0x200000200, 0x200000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2a, 0x0, { 0x1000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2a, 0x0, { 0x2000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2b, 0x66, { 0x10000000, 0x10000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2b, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2b, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5c0f, 0x66, { 0x40000000000, 0x40000000400 } }, // subpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x5c, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vsubpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x5c, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5c0f, 0x0, { 0x40000000000, 0x40000000400 } }, // subps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 3, 0x5c, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vsubps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 3, 0x5c, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5c0f, 0xf2, { 0x40000000000, 0x40000000200 } }, // subsd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7b, 0x0, 1, 1, 0, 3, 0x5c, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vsubsd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x5c0f, 0xf3, { 0x40000000000, 0x40000000100 } }, // subss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x7a, 0x0, 1, 1, 0, 3, 0x5c, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vsubss
+	{ 0, 0, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xf8010f, 0x0, {  } }, // swapgs
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x50f, 0x0, {  } }, // syscall
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x340f, 0x0, {  } }, // sysenter
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x350f, 0x0, {  } }, // sysexit
+	{ 0, 0, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x350f, 0x0, { 0x40000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x70f, 0x0, {  } }, // sysret
+	{ 0, 0, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0x70f, 0x0, { 0x40000 } },
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa8, 0x0, { 0x4000000, 0x2 } }, // test
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa9, 0x66, { 0x20000000, 0x4 } },
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa9, 0x0, { 0x100000000, 0x8 } },
+	{ 0, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0xa9, 0x0, { 0x400000000, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xf6, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xf7, 0x66, { 0x10000080, 0x4 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xf7, 0x0, { 0x80000100, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 0, 0, 2, 0xf7, 0x0, { 0x200000200, 0x8 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x84, 0x0, { 0x1000040, 0x1000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x84, 0x0, { 0x1000040, 0x2000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x85, 0x66, { 0x10000080, 0x10000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x85, 0x0, { 0x80000100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x85, 0x0, { 0x200000200, 0x200000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 2, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xbc0f, 0xf366, { 0x10000000, 0x10000080 } }, // tzcnt
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xbc0f, 0xf3, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xbc0f, 0xf3, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2e0f, 0x66, { 0x40000000000, 0x40000000200 } }, // ucomisd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 2, 0x2e, 0x0, { 0x40000000000, 0x40000000200 } }, // vucomisd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x2e0f, 0x0, { 0x40000000000, 0x40000000100 } }, // ucomiss
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 2, 0x2e, 0x0, { 0x40000000000, 0x40000000100 } }, // vucomiss
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xb0f, 0x0, {  } }, // ud2
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x150f, 0x66, { 0x40000000000, 0x40000000400 } }, // unpckhpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x15, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vunpckhpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x15, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x150f, 0x0, { 0x40000000000, 0x40000000400 } }, // unpckhps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 3, 0x15, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vunpckhps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 3, 0x15, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x140f, 0x66, { 0x40000000000, 0x40000000400 } }, // unpcklpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x14, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vunpcklpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x14, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x140f, 0x0, { 0x40000000000, 0x40000000400 } }, // unpcklps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 3, 0x14, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vunpcklps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 3, 0x14, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x18, 0x0, { 0x40000000000, 0x100 } }, // vbroadcastss
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x18, 0x0, { 0x100000000000, 0x100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x18, 0x0, { 0x40000000000, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x18, 0x0, { 0x100000000000, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x19, 0x0, { 0x100000000000, 0x200 } }, // vbroadcastsd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x19, 0x0, { 0x100000000000, 0x40000000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x1a, 0x0, { 0x100000000000, 0x400 } }, // vbroadcastf128
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x13, 0x0, { 0x100000000000, 0x40000000400 } }, // vcvtph2ps
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x13, 0x0, { 0x40000000000, 0x40000000200 } },
+	{ 1, 2, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 3, 0x1d, 0x0, { 0x40000000400, 0x100000000000, 0x2 } }, // vcvtps2ph
+	{ 1, 2, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 3, 0x1d, 0x0, { 0x40000000200, 0x40000000000, 0x2 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0xf, 0x0, { 0x10000080 } }, // verr
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x28, 1, 0, 0, 1, 0xf, 0x0, { 0x10000080 } }, // verw
+	{ 1, 2, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 3, 0x19, 0x0, { 0x40000000400, 0x100000000000, 0x2 } }, // vextractf128
+	{ 1, 2, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 3, 0x39, 0x0, { 0x40000000400, 0x100000000000, 0x2 } }, // vextracti128
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x98, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmadd132pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0x98, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xa8, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmadd213pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0xa8, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xb8, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmadd231pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0xb8, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x98, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmadd132ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x98, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xa8, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmadd213ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0xa8, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xb8, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmadd231ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0xb8, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x99, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vfmadd132sd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xa9, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vfmadd213sd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xb9, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vfmadd231sd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x99, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vfmadd132ss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xa9, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vfmadd213ss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xb9, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vfmadd231ss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x96, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmaddsub132pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0x96, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xa6, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmaddsub213pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0xa6, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xb6, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmaddsub231pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0xb6, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x96, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmaddsub132ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x96, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xa6, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmaddsub213ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0xa6, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xb6, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmaddsub231ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0xb6, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x97, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmsubadd132pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0x97, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xa7, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmsubadd213pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0xa7, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xb7, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmsubadd231pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0xb7, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x97, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmsubadd132ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x97, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xa7, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmsubadd213ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0xa7, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xb7, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmsubadd231ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0xb7, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x9a, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmsub132pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0x9a, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xaa, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmsub213pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0xaa, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xba, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmsub231pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0xba, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x9a, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmsub132ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x9a, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xaa, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmsub213ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0xaa, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xba, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfmsub231ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0xba, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x9b, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vfmsub132sd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xab, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vfmsub213sd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xbb, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vfmsub231sd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x9b, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vfmsub132ss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xab, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vfmsub213ss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xbb, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vfmsub231ss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x9c, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfnmadd132pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0x9c, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xac, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfnmadd213pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0xac, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xbc, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfnmadd231pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0xbc, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x9c, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfnmadd132ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x9c, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xac, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfnmadd213ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0xac, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xbc, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfnmadd231ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0xbc, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x9d, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vfnmadd132sd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xad, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vfnmadd213sd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xbd, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vfnmadd231sd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x9d, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vfnmadd132ss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xad, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vfnmadd213ss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xbd, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vfnmadd231ss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x9e, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfnmsub132pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0x9e, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xae, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfnmsub213pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0xae, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xbe, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfnmsub231pd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0xbe, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x9e, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfnmsub132ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x9e, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xae, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfnmsub213ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0xae, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xbe, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vfnmsub231ps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0xbe, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x9f, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vfnmsub132sd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xaf, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vfnmsub213sd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0xbf, 0x0, { 0x40000000000, 0x40000000000, 0x40000000200 } }, // vfnmsub231sd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x9f, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vfnmsub132ss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xaf, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vfnmsub213ss
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xbf, 0x0, { 0x40000000000, 0x40000000000, 0x40000000100 } }, // vfnmsub231ss
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x92, 0x0, { 0x40000000000, 0x100, 0x40000000000 } }, // vgatherdpd
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0x92, 0x0, { 0x100000000000, 0x100, 0x100000000000 } },
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x93, 0x0, { 0x40000000000, 0x200, 0x40000000000 } }, // vgatherqpd
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0x93, 0x0, { 0x100000000000, 0x200, 0x100000000000 } },
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x92, 0x0, { 0x40000000000, 0x100, 0x40000000000 } }, // vgatherdps
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x92, 0x0, { 0x100000000000, 0x100, 0x100000000000 } },
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x93, 0x0, { 0x40000000000, 0x200, 0x40000000000 } }, // vgatherqps
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x93, 0x0, { 0x40000000000, 0x200, 0x40000000000 } },
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x90, 0x0, { 0x40000000000, 0x100, 0x40000000000 } }, // vpgatherdd
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x90, 0x0, { 0x100000000000, 0x100, 0x100000000000 } },
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x91, 0x0, { 0x40000000000, 0x200, 0x40000000000 } }, // vpgatherqd
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x91, 0x0, { 0x40000000000, 0x200, 0x40000000000 } },
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x90, 0x0, { 0x40000000000, 0x100, 0x40000000000 } }, // vpgatherdq
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0x90, 0x0, { 0x100000000000, 0x100, 0x100000000000 } },
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x91, 0x0, { 0x40000000000, 0x200, 0x40000000000 } }, // vpgatherqq
+	{ 2, 1, 0, 3, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0x91, 0x0, { 0x100000000000, 0x200, 0x100000000000 } },
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 4, 0x18, 0x0, { 0x100000000000, 0x100000000000, 0x40000000400, 0x2 } }, // vinsertf128
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 4, 0x38, 0x0, { 0x100000000000, 0x100000000000, 0x40000000400, 0x2 } }, // vinserti128
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x2c, 0x0, { 0x40000000000, 0x40000000000, 0x400 } }, // vmaskmovps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x2c, 0x0, { 0x100000000000, 0x100000000000, 0x800 } },
+	{ 1, 3, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x2e, 0x0, { 0x400, 0x40000000000, 0x40000000000 } },
+	{ 1, 3, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x2e, 0x0, { 0x800, 0x100000000000, 0x100000000000 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x2d, 0x0, { 0x40000000000, 0x40000000000, 0x400 } }, // vmaskmovpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x2d, 0x0, { 0x100000000000, 0x100000000000, 0x800 } },
+	{ 1, 3, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x2f, 0x0, { 0x400, 0x40000000000, 0x40000000000 } },
+	{ 1, 3, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x2f, 0x0, { 0x800, 0x100000000000, 0x100000000000 } },
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 4, 0x2, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400, 0x2 } }, // vpblendd
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 4, 0x2, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800, 0x2 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x78, 0x0, { 0x40000000000, 0x40000000040 } }, // vpbroadcastb
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x78, 0x0, { 0x100000000000, 0x40000000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x79, 0x0, { 0x40000000000, 0x40000000080 } }, // vpbroadcastw
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x79, 0x0, { 0x100000000000, 0x40000000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x58, 0x0, { 0x40000000000, 0x40000000100 } }, // vpbroadcastd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x58, 0x0, { 0x100000000000, 0x40000000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0x59, 0x0, { 0x40000000000, 0x40000000200 } }, // vpbroadcastq
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x59, 0x0, { 0x100000000000, 0x40000000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0x5a, 0x0, { 0x100000000000, 0x400 } }, // vbroadcasti128
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x36, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } }, // vpermd
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0xfd, 0x0, 1, 1, 0, 3, 0x1, 0x0, { 0x100000000000, 0x100000000800, 0x2 } }, // vpermpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x16, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } }, // vpermps
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0xfd, 0x0, 1, 1, 0, 3, 0x0, 0x0, { 0x100000000000, 0x100000000800, 0x2 } }, // vpermq
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 4, 0x46, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800, 0x2 } }, // vperm2i128
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xd, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpermilpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0xd, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 3, 0x5, 0x0, { 0x40000000000, 0x40000000400, 0x2 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 3, 0x5, 0x0, { 0x100000000000, 0x100000000800, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0xc, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpermilps
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x79, 0x0, 1, 1, 0, 3, 0x4, 0x0, { 0x40000000000, 0x40000000400, 0x2 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0xc, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 3, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 3, 0x4, 0x0, { 0x100000000000, 0x100000000800, 0x2 } },
+	{ 3, 1, 0, 2, 4, 0, 0x0, 1, 0, 0x83, 0x7d, 0x0, 1, 1, 0, 4, 0x6, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800, 0x2 } }, // vperm2f128
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x8c, 0x0, { 0x40000000000, 0x40000000000, 0x400 } }, // vpmaskmovd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x8c, 0x0, { 0x100000000000, 0x100000000000, 0x800 } },
+	{ 1, 3, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x8e, 0x0, { 0x400, 0x40000000000, 0x40000000000 } },
+	{ 1, 3, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x8e, 0x0, { 0x800, 0x100000000000, 0x100000000000 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x8c, 0x0, { 0x40000000000, 0x40000000000, 0x400 } }, // vpmaskmovq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0x8c, 0x0, { 0x100000000000, 0x100000000000, 0x800 } },
+	{ 1, 3, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x8e, 0x0, { 0x400, 0x40000000000, 0x40000000000 } },
+	{ 1, 3, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0x8e, 0x0, { 0x800, 0x100000000000, 0x100000000000 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x47, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsllvd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x47, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x47, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsllvq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0x47, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x46, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsravd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x46, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 3, 0x45, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsrlvd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 3, 0x45, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xf9, 0x0, 1, 1, 0, 3, 0x45, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vpsrlvq
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x82, 0xfd, 0x0, 1, 1, 0, 3, 0x45, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0xe, 0x0, { 0x40000000000, 0x40000000400 } }, // vtestps
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0xe, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x79, 0x0, 1, 1, 0, 2, 0xf, 0x0, { 0x40000000000, 0x40000000400 } }, // vtestpd
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x82, 0x7d, 0x0, 1, 1, 0, 2, 0xf, 0x0, { 0x100000000000, 0x100000000800 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 0, 0, 0, 0, 0x77, 0x0, {  } }, // vzeroall
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 0, 0, 0, 0, 0x77, 0x0, {  } }, // vzeroupper
+	{ 0, 0, 0, 0, 0, 0, 0x0, 0, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x0, 0x9b, {  } }, // wait
+	{ 0, 0, 0, 0, 0, 0, 0x0, 0, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x0, 0x9b, {  } }, // fwait
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x90f, 0x0, {  } }, // wbinvd
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0xae0f, 0xf3, { 0x80000000 } }, // wrfsbase
+	{ 1, 0, 0, 0, 0, 0, 0x48, 2, 1, 0x0, 0x0, 0x10, 1, 0, 0, 1, 0xae0f, 0xf3, { 0x200000000 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xae0f, 0xf3, { 0x80000000 } }, // wrgsbase
+	{ 1, 0, 0, 0, 0, 0, 0x48, 2, 1, 0x0, 0x0, 0x18, 1, 0, 0, 1, 0xae0f, 0xf3, { 0x200000000 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x300f, 0x0, {  } }, // wrmsr
+	{ 0, 0, 0, 0, 0, 0, 0x0, 0, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x0, 0xf2, {  } }, // xacquire
+	{ 0, 0, 0, 0, 0, 0, 0x0, 0, 1, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0x0, 0xf3, {  } }, // xrelease
+	{ 0, 0, 0, 0, 1, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xf8c6, 0x0, { 0x2 } }, // xabort
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xc00f, 0x0, { 0x1000040, 0x1000000 } }, // xadd
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xc00f, 0x0, { 0x1000040, 0x2000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xc10f, 0x66, { 0x10000080, 0x10000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xc10f, 0x0, { 0x80000100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0xc10f, 0x0, { 0x200000200, 0x200000000 } },
+	{ 0, 0, 1, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xf8c7, 0x0, { 0x1000000000 } }, // xbegin
+	{ 0, 1, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x90, 0x66, { 0x20000000, 0x10000000 } }, // xchg
+	{ 0, 1, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x90, 0x66, { 0x10000000, 0x20000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x90, 0x0, { 0x100000000, 0x80000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x90, 0x0, { 0x400000000, 0x200000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x90, 0x0, { 0x80000000, 0x100000000 } },
+	{ 0, 1, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x90, 0x0, { 0x200000000, 0x400000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x86, 0x0, { 0x1000040, 0x1000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x86, 0x0, { 0x1000040, 0x2000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x86, 0x0, { 0x1000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x86, 0x0, { 0x2000000, 0x1000040 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x87, 0x66, { 0x10000080, 0x10000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x87, 0x66, { 0x10000000, 0x10000080 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x87, 0x0, { 0x80000100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x87, 0x0, { 0x200000200, 0x200000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x87, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x87, 0x0, { 0x200000000, 0x200000200 } },
+	{ 0, 0, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xd5010f, 0x0, {  } }, // xend
+	{ 0, 0, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xd0010f, 0x0, {  } }, // xgetbv
+	{ 0, 0, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 1, 0xd7, 0x0, { 0x40 } }, // xlat
+	{ 0, 0, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xd7, 0x0, {  } }, // xlatb
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x34, 0x0, { 0x4000000, 0x2 } }, // xor
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x35, 0x66, { 0x20000000, 0x4 } },
+	{ 0, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x35, 0x0, { 0x100000000, 0x8 } },
+	{ 0, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 0, 0, 0, 2, 0x35, 0x0, { 0x400000000, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x30, 1, 0, 0, 2, 0x80, 0x0, { 0x1000040, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 1, 0x0, 0x0, 0x30, 1, 0, 0, 2, 0x81, 0x66, { 0x10000080, 0x4 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x30, 1, 0, 0, 2, 0x81, 0x0, { 0x80000100, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x30, 1, 0, 0, 2, 0x81, 0x0, { 0x200000200, 0x8 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x30, 1, 0, 1, 2, 0x83, 0x0, { 0x10000080, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x0, 1, 0, 0x0, 0x0, 0x30, 1, 0, 1, 2, 0x83, 0x0, { 0x80000100, 0x2 } },
+	{ 1, 0, 0, 0, 2, 0, 0x48, 1, 0, 0x0, 0x0, 0x30, 1, 0, 1, 2, 0x83, 0x0, { 0x200000200, 0x2 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x30, 0x0, { 0x1000040, 0x1000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x30, 0x0, { 0x1000040, 0x2000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x31, 0x66, { 0x10000080, 0x10000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x31, 0x0, { 0x80000100, 0x80000000 } },
+	{ 1, 2, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 1, 2, 0x31, 0x0, { 0x200000200, 0x200000000 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x32, 0x0, { 0x1000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x32, 0x0, { 0x2000000, 0x1000040 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x33, 0x66, { 0x10000000, 0x10000080 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x33, 0x0, { 0x80000000, 0x80000100 } },
+	{ 2, 1, 0, 0, 0, 0, 0x48, 1, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x33, 0x0, { 0x200000000, 0x200000200 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 1, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x570f, 0x66, { 0x40000000000, 0x40000000400 } }, // xorpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x79, 0x0, 1, 1, 0, 3, 0x57, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vxorpd
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7d, 0x0, 1, 1, 0, 3, 0x57, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 2, 1, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x0, 1, 1, 0, 2, 0x570f, 0x0, { 0x40000000000, 0x40000000400 } }, // xorps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x1, 0x78, 0x0, 1, 1, 0, 3, 0x57, 0x0, { 0x40000000000, 0x40000000000, 0x40000000400 } }, // vxorps
+	{ 3, 1, 0, 2, 0, 0, 0x0, 1, 0, 0x81, 0x7c, 0x0, 1, 1, 0, 3, 0x57, 0x0, { 0x100000000000, 0x100000000000, 0x100000000800 } },
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x28, 1, 0, 0, 1, 0xae0f, 0x0, { 0x1fc0 } }, // xrstor
+	{ 1, 0, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x28, 1, 0, 0, 1, 0xae0f, 0x0, { 0x1fc0 } }, // xrstor64
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0xae0f, 0x0, { 0x1fc0 } }, // xsave
+	{ 1, 0, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x20, 1, 0, 0, 1, 0xae0f, 0x0, { 0x1fc0 } }, // xsave64
+	{ 1, 0, 0, 0, 0, 0, 0x0, 2, 0, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xae0f, 0x0, { 0x1fc0 } }, // xsaveopt
+	{ 1, 0, 0, 0, 0, 0, 0x48, 2, 0, 0x0, 0x0, 0x30, 1, 0, 0, 1, 0xae0f, 0x0, { 0x1fc0 } }, // xsaveopt64
+	{ 0, 0, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xd1010f, 0x0, {  } }, // xsetbv
+	{ 0, 0, 0, 0, 0, 0, 0x0, 3, 0, 0x0, 0x0, 0x0, 0, 0, 0, 0, 0xd6010f, 0x0, {  } }, // xtest
+};
+
+// Index of each op's first form in `forms`, so op `i`'s forms are `forms[op_forms[i - 1]]` up to `forms[op_forms[i]]`.
+inline constexpr uint16_t op_forms[] = {
+	0, 21, 42, 43, 45, 46, 48, 49, 50, 51, 52, 53, 55, 56, 58, 59,
+	60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 91, 93, 94, 96, 97,
+	99, 100, 102, 103, 105, 106, 108, 110, 111, 113, 114, 116, 117, 119, 121, 123,
+	125, 128, 131, 133, 139, 145, 151, 157, 159, 164, 165, 166, 167, 168, 169, 170,
+	171, 172, 173, 176, 179, 182, 185, 188, 191, 194, 197, 200, 203, 206, 209, 212,
+	215, 218, 221, 224, 227, 230, 233, 236, 239, 242, 245, 248, 251, 254, 257, 260,
+	263, 284, 285, 287, 288, 290, 294, 295, 296, 298, 299, 300, 301, 302, 307, 308,
+	309, 310, 311, 312, 313, 314, 319, 320, 322, 323, 325, 326, 328, 329, 330, 332,
+	333, 334, 335, 337, 338, 340, 341, 343, 345, 346, 347, 349, 351, 353, 355, 356,
+	357, 359, 361, 362, 364, 365, 366, 368, 369, 371, 373, 375, 377, 378, 379, 380,
+	384, 388, 389, 391, 392, 394, 395, 396, 397, 398, 399, 400, 401, 403, 404, 405,
+	406, 407, 408, 409, 413, 415, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+	427, 428, 429, 430, 434, 438, 439, 440, 441, 442, 443, 444, 445, 449, 451, 453,
+	457, 459, 461, 462, 464, 466, 469, 470, 471, 472, 474, 477, 480, 484, 485, 486,
+	487, 488, 489, 490, 491, 492, 493, 497, 499, 501, 502, 503, 504, 505, 506, 507,
+	508, 509, 510, 511, 512, 513, 514, 517, 521, 522, 523, 524, 525, 527, 529, 533,
+	535, 537, 541, 543, 545, 546, 548, 550, 551, 552, 554, 555, 556, 557, 558, 559,
+	560, 561, 562, 564, 565, 567, 568, 569, 571, 572, 574, 578, 591, 597, 601, 604,
+	605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 620, 622,
+	624, 626, 628, 629, 630, 632, 634, 636, 638, 640, 642, 644, 646, 648, 650, 652,
+	654, 656, 658, 660, 662, 664, 666, 668, 670, 672, 674, 676, 678, 680, 686, 687,
+	690, 691, 693, 694, 695, 698, 701, 704, 707, 709, 710, 711, 712, 713, 714, 715,
+	719, 720, 721, 722, 723, 724, 725, 726, 729, 730, 733, 734, 735, 736, 737, 739,
+	740, 742, 743, 744, 745, 746, 747, 748, 750, 751, 753, 754, 755, 756, 757, 758,
+	797, 799, 803, 805, 809, 815, 819, 827, 829, 834, 835, 837, 839, 843, 845, 849,
+	850, 851, 852, 854, 856, 858, 860, 861, 862, 864, 866, 868, 870, 871, 873, 874,
+	876, 877, 879, 880, 882, 884, 885, 887, 888, 890, 891, 892, 896, 897, 898, 901,
+	902, 906, 907, 909, 910, 912, 914, 918, 923, 924, 926, 930, 932, 936, 941, 942,
+	944, 948, 949, 951, 952, 954, 955, 956, 957, 958, 960, 961, 965, 968, 972, 993,
+	994, 996, 997, 999, 1005, 1008, 1009, 1010, 1011, 1013, 1015, 1017, 1019, 1021, 1023, 1025,
+	1027, 1029, 1031, 1032, 1034, 1036, 1038, 1040, 1042, 1044, 1046, 1048, 1050, 1052, 1054, 1056,
+	1058, 1060, 1062, 1064, 1066, 1068, 1070, 1072, 1074, 1076, 1078, 1080, 1082, 1083, 1085, 1087,
+	1089, 1091, 1092, 1094, 1095, 1097, 1098, 1099, 1101, 1103, 1105, 1107, 1109, 1111, 1112, 1114,
+	1115, 1116, 1117, 1118, 1120, 1122, 1124, 1126, 1128, 1130, 1131, 1133, 1134, 1135, 1136, 1137,
+	1139, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1150, 1152, 1154, 1156, 1158, 1160, 1162, 1164,
+	1165, 1166, 1168, 1170, 1172, 1174, 1176, 1178, 1179, 1180, 1181, 1182, 1183, 1185, 1186, 1188,
+	1190, 1192, 1194, 1195, 1197, 1198, 1200, 1202, 1204, 1206, 1208, 1209, 1211, 1212, 1214, 1215,
+	1217, 1218, 1220, 1222, 1223, 1225, 1227, 1228, 1230, 1231, 1233, 1235, 1237, 1238, 1239, 1240,
+	1241, 1242, 1243, 1245, 1247, 1249, 1251, 1253, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1263,
+	1265, 1267, 1269, 1271, 1273, 1274, 1276, 1278, 1280, 1282, 1284, 1286, 1288, 1289, 1291, 1293,
+	1295, 1297, 1299, 1307, 1310, 1311, 1312, 1314, 1316, 1317, 1318, 1319, 1320, 1322, 1324, 1326,
+	1328, 1329, 1331, 1332, 1334, 1335, 1337, 1338, 1340, 1342, 1344, 1345, 1346, 1347, 1348, 1350,
+	1354, 1358, 1362, 1366, 1370, 1374, 1378, 1382, 1386, 1390, 1391, 1393, 1397, 1401, 1405, 1409,
+	1413, 1417, 1419, 1421, 1423, 1425, 1427, 1429, 1431, 1433, 1435, 1437, 1439, 1441, 1443, 1445,
+	1447, 1449, 1450, 1452, 1454, 1456, 1458, 1459, 1461, 1463, 1465, 1467, 1469, 1471, 1473, 1474,
+	1476, 1478, 1480, 1482, 1488, 1491, 1493, 1494, 1495, 1497, 1499, 1511, 1523, 1535, 1547, 1548,
+	1550, 1551, 1552, 1554, 1556, 1557, 1558, 1561, 1562, 1563, 1568, 1573, 1578, 1583, 1588, 1593,
+	1598, 1603, 1608, 1612, 1614, 1615, 1617, 1618, 1620, 1621, 1622, 1623, 1624, 1625, 1627, 1628,
+	1629, 1630, 1642, 1654, 1666, 1678, 1680, 1682, 1684, 1705, 1709, 1710, 1711, 1712, 1713, 1714,
+	1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730,
+	1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1751,
+	1757, 1758, 1760, 1761, 1763, 1764, 1766, 1769, 1770, 1772, 1773, 1775, 1776, 1777, 1778, 1779,
+	1780, 1781, 1782, 1783, 1784, 1788, 1789, 1790, 1791, 1792, 1793, 1814, 1815, 1817, 1818, 1820,
+	1821, 1822, 1823, 1824, 1825, 1826, 1827, 1829, 1831, 1844, 1847, 1848, 1849, 1850, 1851, 1852,
+	1853, 1855, 1856, 1858, 1859, 1861, 1862, 1864, 1868, 1870, 1871, 1873, 1875, 1876, 1877, 1878,
+	1879, 1881, 1883, 1885, 1887, 1889, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1899, 1901, 1903,
+	1905, 1907, 1909, 1911, 1913, 1915, 1917, 1919, 1921, 1923, 1925, 1927, 1929, 1931, 1933, 1934,
+	1935, 1936, 1937, 1938, 1939, 1941, 1943, 1945, 1947, 1949, 1951, 1952, 1953, 1954, 1955, 1956,
+	1957, 1959, 1961, 1963, 1965, 1967, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1977, 1979, 1981,
+	1983, 1985, 1987, 1989, 1991, 1992, 1993, 1997, 2001, 2003, 2005, 2007, 2009, 2011, 2012, 2013,
+	2014, 2015, 2016, 2017, 2021, 2025, 2026, 2030, 2034, 2036, 2038, 2040, 2042, 2044, 2046, 2048,
+	2049, 2050, 2051, 2052, 2053, 2055, 2057, 2058, 2059, 2060, 2061, 2066, 2067, 2083, 2084, 2085,
+	2086, 2087, 2108, 2109, 2111, 2112, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122,
+};
+
+// None of these are constexpr, so calling them in a constant expression is the compile error, and their names the message.
+void error_invalid_instruction();
+void error_argument_mismatch();
+void error_esp_rsp_used_as_index();
+void error_rel_out_of_range();
+void error_invalid_label();
+
+constexpr const x64Form& identify(const x64Ins& ins) {
+	if(ins.op < 1 || ins.op > sizeof(op_forms) / sizeof(op_forms[0]) - 1) error_invalid_instruction();
+
+	uint64_t insoperands[] = { ins.params[0].type, ins.params[1].type, ins.params[2].type, ins.params[3].type };
+
+	uint32_t operandnum = 0;
+	while(operandnum < 4 && insoperands[operandnum])
+		operandnum ++;
+
+	// Same ambiguous immediate and rel() resolution as identify() in asm_x64.c.
+	if(ins.op == MOV) {
+		uint8_t immplace = insoperands[1] & (IMM8 | IMM16 | IMM32 | IMM64) ? 2 : 1;
+		if((insoperands[immplace - 1] & IMM64) && (insoperands[immplace - 1] & IMM32) && (insoperands[2 - immplace] & R64)) {
+			if(ins.params[immplace - 1].value > 0x100000000) insoperands[immplace - 1] = IMM64;
+			else if(ins.params[immplace - 1].value > 0x10000) insoperands[immplace - 1] = IMM32 | IMM8 | IMM16;
+		}
+	}
+	else if(insoperands[0] & REL8) {
+		if((int32_t) ins.params[0].value > 8 || (int32_t) ins.params[0].value < -8) insoperands[0] = REL32;
+		else insoperands[0] = REL8;
+	}
+
+	// When several forms match, the last preferred one wins, otherwise the first one.
+	const x64Form* found = nullptr;
+	for(uint32_t i = op_forms[ins.op - 1]; i < op_forms[ins.op]; i ++) {
+		const x64Form& form = forms[i];
+		if(form.arglen != operandnum) continue;
+
+		bool match = true;
+		for(uint32_t j = 0; j < operandnum; j ++)
+			match = match && (form.args[j] & insoperands[j]);
+		if(match && (!found || form.preffered)) found = &form;
+	}
+
+	if(!found) error_argument_mismatch();
+	return *found;
+}
+
+constexpr void put(uint8_t*& dest, uint64_t value, uint32_t size) {
+	for(uint32_t i = 0; i < size; i ++)
+		*dest ++ = value >> i * 8;
+}
+
+// Byte for byte the same encoding as encode() in asm_x64.c.
+constexpr uint32_t encode(const x64Ins& ins, const x64Form& res, uint8_t* dest) {
+	uint8_t* const start = dest;
+
+	// Enter is the weirdest instruction ever :'(
+	if(ins.op == ENTER) {
+		put(dest, 0xC8 | (uint32_t) (uint16_t) ins.params[0].value << 8 | (uint32_t) (uint8_t) ins.params[1].value << 24, 4);
+		return 4;
+	}
+
+	const x64Operand none;
+	const x64Operand& rm = res.mem_oper ? ins.params[res.mem_oper - 1] : none;
+	const uint64_t rmvalue = rm.value;
+	const bool rmmem = rm.type & X64_ALLMEMMASK;
+	const uint32_t base = rmvalue >> 32 & 0x1f, index = rmvalue >> 40 & 0x1f;
+	const bool regext = res.reg_oper && ins.params[res.reg_oper - 1].value & 0x8;
+
+	if(res.mem_oper) {
+		if(rmvalue & (uint64_t) 0x7 << 56) *dest ++ = ((const uint8_t[]) { 0x26, 0x2e, 0x36, 0x3e, 0x64, 0x65 })[(rmvalue >> 56 & 0x7) - 1];
+		if(rmvalue & (uint64_t) 0x1 << 60) *dest ++ = 0x67;
+	}
+
+	if(res.vex) {
+		uint8_t vex_byte = res.vex_byte;
+		if(res.vex_oper) vex_byte &= ~(ins.params[res.vex_oper - 1].value << 3);
+
+		uint8_t vex_r = 0x80, vex_x = 0x40, vex_b = 0x20;
+		if(regext) res.modrmreg ? (vex_r = 0) : (vex_b = 0);
+		if(res.mem_oper) {
+			if(rmmem) {
+				if(base & 0x8) vex_b = 0;
+				if(index & 0x8) vex_x = 0;
+			} else if(rmvalue & 0x8) vex_b = 0;
+		}
+
+		if((res.vex >> 4) || !vex_x || !vex_b) *dest ++ = 0xC4, *dest ++ = (res.vex & 0xf) | vex_r | vex_x | vex_b, *dest ++ = vex_byte;
+		else *dest ++ = 0xC5, *dest ++ = vex_byte | vex_r;
+	} else {
+		put(dest, res.prefixes, res.preflen);
+
+		uint8_t rex = res.rex;
+		if(regext) rex |= res.modrmreg ? 0x44 : 0x41;
+		if(res.mem_oper) {
+			if(rmmem) {
+				if(base & 0x8) rex |= 0x41;
+				if(index & 0x8) rex |= 0x42;
+			} else if(rmvalue & 0x8) rex |= 0x41;
+		}
+		if(rex) *dest ++ = rex;
+	}
+
+	put(dest, res.opcode, res.oplen);
+
+	if(res.modrmreq) {
+		uint8_t modrm = res.modrm;
+		if(res.modrmreg) modrm |= (ins.params[res.reg_oper - 1].value & 0x7) << 3;
+		const int32_t disp = rmvalue;
+
+		if(!rmmem) *dest ++ = modrm | 0xC0 | (rmvalue & 0x7);
+		else if(rmvalue & 0x2000000000000000) *dest ++ = modrm | 0x05, put(dest, disp, 4); // RIP-relative addressing
+		else if(base & 0x10) // No base register
+			*dest ++ = modrm | 0x04, *dest ++ = index & 0x10 ? 0x25 : (rmvalue >> 48 & 0x3) << 6 | (index & 0x7) << 3 | 0x5, put(dest, disp, 4);
+		else if(disp || index != 0x10) {
+			if(index & 0x10 && (base & 0x7) != $esp) { // No SIB byte required!
+				if(disp < 128 && disp >= -128) *dest ++ = modrm | 0x40 | (base & 0x7), put(dest, disp, 1);
+				else *dest ++ = modrm | 0x80 | (base & 0x7), put(dest, disp, 4);
+			} else {
+				if(index == $esp) error_esp_rsp_used_as_index();
+				const uint8_t sib = (rmvalue >> 48 & 0x3) << 6 | (index & 0x10 ? 0x4 : index) << 3 | (base & 0x7);
+
+				if(!disp) *dest ++ = modrm | 0x04, *dest ++ = sib;
+				else if(disp < 128 && disp >= -128) *dest ++ = modrm | 0x44, *dest ++ = sib, put(dest, disp, 1);
+				else *dest ++ = modrm | 0x84, *dest ++ = sib, put(dest, disp, 4);
+			}
+		}
+		else if((base & 0x7) == $esp) *dest ++ = modrm | 0x04, *dest ++ = 0x24;
+		else if((base & 0x7) == $ebp) *dest ++ = modrm | 0x45, *dest ++ = 0;
+		else *dest ++ = modrm | (base & 0x7);
+	}
+	else if(res.reg_oper) dest[-1] |= ins.params[res.reg_oper - 1].value & 0x7;
+
+	if(res.imm_oper) put(dest, ins.params[res.imm_oper - 1].value, res.args[res.imm_oper - 1] >> 1);
+	else if(res.rel_oper) put(dest, ins.params[res.rel_oper - 1].value, res.args[res.rel_oper - 1] == REL8 ? 1 : 4);
+	else if(res.is4_oper) *dest ++ = (uint8_t) ins.params[res.is4_oper - 1].value << 4;
+
+	return dest - start;
+}
+
+// Emits 1 instruction.
+consteval uint32_t x64emit(const x64Ins& ins, uint8_t* opcode_dest) {
+	return encode(ins, identify(ins), opcode_dest);
+}
+
+constexpr bool has_form(uint32_t op, uint32_t param, uint64_t type) {
+	for(uint32_t i = op_forms[op - 1]; i < op_forms[op]; i ++)
+		if(forms[i].args[param] == type) return true;
+	return false;
+}
+
+// Index of the rel() operand of an instruction, or -1 if it doesn't have one.
+constexpr int rel_param(const x64Ins& ins) {
+	if(ins.op < 1 || ins.op > sizeof(op_forms) / sizeof(op_forms[0]) - 1) return -1;
+	for(int j = 0; j < 4 && ins.params[j].type; j ++)
+		if(ins.params[j].type & (REL8 | REL32)) return j;
+	return -1;
+}
+
+// The instruction with its rel() narrowed to a rel8 where it has one, or widened to a rel32, pointing nowhere yet.
+constexpr x64Ins sized(x64Ins ins, bool wide) {
+	const int j = rel_param(ins);
+	if(j < 0) return ins;
+	ins.params[j].type = !wide && ins.params[j].type & REL8 && has_form(ins.op, j, REL8) ? REL8 : REL32;
+	ins.params[j].value = 0;
+	return ins;
+}
+
+// Instruction a rel() or lb() points to.
+template<size_t N>
+constexpr int64_t rel_target(const std::array<x64Ins, N>& code, size_t i, int j) {
+	if(!(code[i].params[j].type & X64_LABEL_REF)) return (int64_t) i + (int32_t) code[i].params[j].value;
+
+	int64_t target = -1;
+	for(size_t k = 0; k < N; k ++)
+		if(code[k].op == X64_LABEL_DEF && code[k].params[0].value == code[i].params[j].value) {
+			if(target >= 0) error_invalid_label();
+			target = k;
+		}
+	if(target < 0) error_invalid_label();
+	return target;
+}
+
+// How much padding an align() takes at `at`.
+constexpr uint32_t padding(const x64Ins& ins, uint32_t at) {
+	const uint32_t alignment = ins.params[0].value;
+	if(!alignment || alignment & (alignment - 1)) error_argument_mismatch();
+
+	const uint32_t padding = -at & (alignment - 1);
+	return padding <= (ins.params[1].type ? ins.params[1].value : alignment - 1) ? padding : 0;
+}
+
+// Pads like x64as(), with the longest NOPs there are or with INT3s.
+constexpr void pad(uint8_t* dest, uint32_t size, uint8_t fill) {
+	constexpr uint8_t nops[9][9] = {
+		{ 0x90 }, { 0x66, 0x90 }, { 0x0f, 0x1f, 0x00 }, { 0x0f, 0x1f, 0x40, 0x00 }, { 0x0f, 0x1f, 0x44, 0x00, 0x00 },
+		{ 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00 }, { 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00 },
+		{ 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	};
+
+	for(uint32_t i = 0; i < size; i += 9) {
+		const uint32_t len = size - i < 9 ? size - i : 9;
+		for(uint32_t j = 0; j < len; j ++) dest[i + j] = fill == 0xcc ? 0xcc : nops[len - 1][j];
+	}
+}
+
+// Whether `ins` is one of the pseudo-instructions x64as() takes, which take no room in the code themselves.
+constexpr bool pseudo(const x64Ins& ins) {
+	return ins.op == X64_LABEL_DEF || ins.op == X64_SECTION || ins.op == X64_ALIGN || ins.op == X64_CONST;
+}
+
+// Size of a pool constant, and its `k`th byte.
+constexpr uint32_t const_size(const x64Ins& ins) {
+	uint32_t size = 0;
+	for(int j = 0; j < 4 && ins.params[j].type; j ++)
+		size += ins.params[j].type & IMM64 ? 8 : ins.params[j].type & IMM32 ? 4 : ins.params[j].type & IMM16 ? 2 : 1;
+	if(!size) error_argument_mismatch();
+	return size;
+}
+
+constexpr uint8_t const_byte(const x64Ins& ins, uint32_t k) {
+	for(int j = 0; j < 4 && ins.params[j].type; j ++) {
+		const uint32_t size = ins.params[j].type & IMM64 ? 8 : ins.params[j].type & IMM32 ? 4 : ins.params[j].type & IMM16 ? 2 : 1;
+		if(k < size) return (uint64_t) ins.params[j].value >> k * 8;
+		k -= size;
+	}
+	return 0;
+}
+
+// Whether the constants at `a` and `b` hold the same bytes.
+constexpr bool same_const(const x64Ins& a, const x64Ins& b) {
+	if(const_size(a) != const_size(b)) return false;
+	for(uint32_t k = 0; k < const_size(a); k ++)
+		if(const_byte(a, k) != const_byte(b, k)) return false;
+	return true;
+}
+
+// Assembles and links rel(), lb() and $riprel references like x64as(), into `opcode_dest`. Jumps get the smallest size
+// that reaches, sections are laid out one after another in order of their IDs, and constants are pooled after all of it,
+// the same way too.
+template<size_t N>
+consteval uint32_t x64as(const std::array<x64Ins, N>& code, uint8_t* opcode_dest) {
+	uint32_t offsets[N + 1] = { 0 }, sizes[N] = { 0 }, sections[N] = { 0 };
+	bool wide[N] = { false };
+
+	for(size_t i = 0, section = X64_HOT; i < N; i ++)
+		sections[i] = code[i].op == X64_SECTION ? (section = code[i].params[0].value) : section;
+
+	for(bool grew = true; grew;) {
+		for(size_t i = 0; i < N; i ++) {
+			uint8_t scratch[15] = { 0 };
+			sizes[i] = pseudo(code[i]) ? 0 : x64emit(sized(code[i], wide[i]), scratch);
+		}
+
+		// Every section in turn, from the lowest ID up.
+		uint32_t at = 0;
+		for(int64_t section = -1, next; ; section = next) {
+			next = INT64_MAX;
+			for(size_t i = 0; i < N; i ++)
+				if(sections[i] > section && sections[i] < next) next = sections[i];
+			if(next == INT64_MAX) break;
+
+			for(size_t i = 0; i < N; i ++) {
+				if(sections[i] != next) continue;
+				if(code[i].op == X64_ALIGN) sizes[i] = padding(code[i], at);
+				offsets[i] = at, at += sizes[i];
+			}
+		}
+		offsets[N] = at;
+
+		grew = false;
+		for(size_t i = 0; i < N; i ++) {
+			const int j = rel_param(code[i]);
+			if(j < 0 || wide[i]) continue;
+
+			const int64_t target = rel_target(code, i, j);
+			if(target < 0 || target > (int64_t) N) error_rel_out_of_range();
+
+			const int64_t disp = (int64_t) offsets[target] - (offsets[i] + sizes[i]);
+			if(identify(sized(code[i], false)).args[j] != REL8 || (disp <= 127 && disp >= -128)) continue;
+			if(!(code[i].params[j].type & REL32) || !has_form(code[i].op, j, REL32)) error_rel_out_of_range();
+			wide[i] = grew = true;
+		}
+	}
+
+	// The most aligned constants first, each value only once.
+	uint32_t end = offsets[N], maxalign = 1;
+	for(size_t i = 0; i < N; i ++)
+		if(code[i].op == X64_CONST && (const_size(code[i]) & -const_size(code[i])) > maxalign)
+			maxalign = (const_size(code[i]) & -const_size(code[i])) < 32 ? const_size(code[i]) & -const_size(code[i]) : 32;
+
+	for(end = (end + maxalign - 1) & -maxalign; offsets[N] < end; offsets[N] ++) opcode_dest[offsets[N]] = 0xcc;
+	for(uint32_t alignment = maxalign; alignment; alignment /= 2)
+		for(size_t i = 0; i < N; i ++) {
+			if(code[i].op != X64_CONST) continue;
+			const uint32_t size = const_size(code[i]);
+			if(((size & -size) < 32 ? size & -size : 32) != alignment) continue;
+
+			size_t k = 0;
+			while(k < i && !(code[k].op == X64_CONST && same_const(code[k], code[i]))) k ++;
+			if(k < i) offsets[i] = offsets[k];
+			else offsets[i] = end, end += size;
+		}
+	offsets[N] = end;
+
+	for(size_t i = 0; i < N; i ++) {
+		if(code[i].op == X64_ALIGN) pad(opcode_dest + offsets[i], sizes[i], code[i].params[2].type ? code[i].params[2].value : 0x90);
+		if(code[i].op == X64_CONST)
+			for(uint32_t k = 0; k < const_size(code[i]); k ++) opcode_dest[offsets[i] + k] = const_byte(code[i], k);
+		if(pseudo(code[i])) continue;
+		x64Ins ins = sized(code[i], wide[i]);
+		const x64Form& res = identify(ins);
+		const uint32_t next = offsets[i] + sizes[i];
+
+		if(res.rel_oper)
+			ins.params[res.rel_oper - 1].value = (int64_t) offsets[rel_target(code, i, res.rel_oper - 1)] - next;
+		else if(res.mem_oper && ins.params[res.mem_oper - 1].value & 0x4000000000000000) {
+			int64_t& value = ins.params[res.mem_oper - 1].value;
+			if((int32_t) value + (int64_t) i < 0 || (int32_t) value + i > N) error_rel_out_of_range();
+			value = (value & ~(int64_t) 0xffffffff) | (uint32_t) (offsets[i + (int32_t) value] - next);
+		}
+
+		encode(ins, res, opcode_dest + offsets[i]);
+	}
+
+	return offsets[N];
+}
+
+// Most bytes `code` can take once assembled: 15 an instruction, plus the padding of align()s and the constant pool.
+template<size_t N>
+constexpr uint32_t x64cap(const std::array<x64Ins, N>& code) {
+	uint32_t cap = N * 15 + 31;
+	for(size_t i = 0; i < N; i ++)
+		cap += code[i].op == X64_ALIGN ? code[i].params[0].value : code[i].op == X64_CONST ? const_size(code[i]) : 0;
+	return cap;
+}
+
+// Length of `code` once assembled.
+template<size_t N>
+consteval uint32_t x64size(const std::array<x64Ins, N>& code) {
+	uint8_t* buf = new uint8_t[x64cap(code)]();
+	const uint32_t size = x64as(code, buf);
+	delete[] buf;
+	return size;
+}
+
+// Assembles `code` into an array of exactly its size.
+template<auto code>
+consteval std::array<uint8_t, x64size(code)> x64as() {
+	uint8_t buf[x64cap(code)] = { 0 };
+	x64as(code, buf);
+
+	std::array<uint8_t, x64size(code)> bytes = { 0 };
+	for(size_t i = 0; i < bytes.size(); i ++) bytes[i] = buf[i];
+	return bytes;
+}
+
+}
@@ -0,0 +1,64 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../asm_x64.h"
+
+// Benchmarks x64as() on generated code from 1 KB to 10 MB of output, to see that its throughput holds as code grows.
+// It stops at 10 MB since the input takes about 14 times as much memory as the output, 140 MB at the top size.
+
+// Blocks of 8 instructions, each starting with a label, with short jumps back to the start of the block and long ones
+// 1000 blocks away, so both rel8s and rel32s are in the mix.
+x64Ins* generate(uint32_t num) {
+	x64Ins* code = malloc(num * sizeof(x64Ins));
+	if(!code) return NULL;
+	const uint32_t blocks = (num + 7) / 8;
+
+	for(uint32_t i = 0; i < num; i ++) {
+		const uint32_t block = i / 8;
+		switch(i % 8) {
+		case 0: code[i] = (x64Ins) lb_def(block); break;
+		case 1: code[i] = (x64Ins) { MOV, rax, imm(0x123456789) }; break;
+		case 2: code[i] = (x64Ins) { ADD, rax, m64($rbx, (i * 8) & 0xffff) }; break;
+		case 3: code[i] = (x64Ins) { LEA, rcx, mem($riprel, 3) }; break;
+		case 4: code[i] = (x64Ins) { IMUL, rdx, rsi, imm(1000) }; break;
+		case 5: code[i] = (x64Ins) { CMP, rax, imm(i) }; break;
+		case 6: code[i] = (x64Ins) { JNZ, lb(block) }; break;
+		case 7: code[i] = (x64Ins) { JMP, lb(block + 1000 < blocks ? block + 1000 : 0) }; break;
+		}
+	}
+	return code;
+}
+
+double now() {
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main() {
+	printf("%12s %12s %10s %10s\n", "output", "instructions", "MB/s", "ns/ins");
+
+	for(uint64_t size = 1000; size <= 10000000; size *= 10) {
+		const uint32_t num = size / 5; // About 5 bytes an instruction
+		x64Ins* code = generate(num);
+		if(!code) return fputs("Out of memory.\n", stderr), 1;
+
+		// Assembles about 100 MB at every size, so the small ones aren't just noise.
+		const uint32_t reps = 100000000 / size;
+		uint32_t len = 0;
+		const double start = now();
+		for(uint32_t r = 0; r < reps; r ++) {
+			uint8_t* assembled = x64as(code, num, &len);
+			if(!assembled) {
+				fprintf(stderr, "%s\n", x64error(NULL));
+				return 1;
+			}
+			free(assembled);
+		}
+		const double elapsed = now() - start;
+
+		printf("%12u %12u %10.1f %10.2f\n", len, num, (double) len * reps / elapsed / 1e6, elapsed * 1e9 / ((double) num * reps));
+		free(code);
+	}
+	return 0;
+}
@@ -0,0 +1,41 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../asm_x64.h"
+
+// Assembles `code`, which has to be `length` bytes ending in a RET, with every byte before the RET
+// past `from` being `fill` if it isn't 0. Then runs it, and it has to return 5.
+static int check(const char* name, x64 code, uint32_t num, uint32_t length, uint32_t from, uint8_t fill) {
+	uint32_t len;
+	uint8_t* assembled = x64as(code, num, &len);
+	if(!assembled) return printf("%s: %s\n", name, x64error(NULL)), 1;
+	if(len != length || assembled[len - 1] != 0xc3) return printf("%s: %u bytes instead of %u\n", name, len, length), free(assembled), 1;
+	for(uint32_t i = from; fill && i < len - 1; i ++)
+		if(assembled[i] != fill) return printf("%s: padding byte %u is %02x\n", name, i, assembled[i]), free(assembled), 1;
+
+	int64_t (*fn)() = (int64_t (*)()) x64exec(assembled, len);
+	int64_t got = fn();
+	x64exec_free(fn, len);
+	free(assembled);
+	if(got != 5) return printf("%s: returned %lld instead of 5\n", name, (long long) got), 1;
+	return 0;
+}
+
+int main() {
+	int failed = 0;
+
+	// 11 bytes of NOPs after the 5 byte MOV, which run like nothing's there.
+	failed += check("nops", (x64) { { MOV, eax, imm(5) }, align(16), { RET } }, 3, 17, 5, 0);
+
+	// The padding to the next multiple of 16 is too long for align_max(), so there isn't any.
+	failed += check("too far for align_max", (x64) { { MOV, eax, imm(5) }, align_max(16, 4), { RET } }, 3, 6, 5, 0);
+	failed += check("close enough for align_max", (x64) { { MOV, eax, imm(5) }, align_max(8, 4), { RET } }, 3, 9, 5, 0);
+
+	// INT3s after the RET, between it and the next function.
+	failed += check("int3s", (x64) { { MOV, eax, imm(5) }, { RET }, align_int3(16), { RET } }, 4, 17, 6, 0xcc);
+
+	uint32_t len;
+	if(x64as((x64) { { MOV, eax, imm(5) }, align(12), { RET } }, 3, &len)) failed ++, puts("align(12): assembled instead of failing");
+
+	if(!failed) puts("All alignment tests passed.");
+	return failed != 0;
+}
@@ -0,0 +1,49 @@
+#include <stdio.h>
+#include "../asm_x64.h"
+
+static int64_t twice(int64_t x) { return x * 2; }
+
+// Whether `p` is in any mapping in /proc/self/maps. Always is where there isn't one.
+static int mapped(const void* p) {
+	FILE* f = fopen("/proc/self/maps", "r");
+	if(!f) return 1;
+	char line[512];
+	unsigned long start, end;
+	while(fgets(line, sizeof(line), f))
+		if(sscanf(line, "%lx-%lx", &start, &end) == 2 && (unsigned long) p >= start && (unsigned long) p < end) return fclose(f), 1;
+	return fclose(f), 0;
+}
+
+int main() {
+	int failed = 0;
+	uint32_t len;
+
+	// Runs where it was assembled, close enough to call the function directly without a veneer.
+	int64_t (*fn)() = (int64_t (*)()) x64as_exec((x64) {
+		{ SUB, rsp, imm(8) },
+		{ MOV, edi, imm(21) },
+		{ CALL, relptr(twice) },
+		{ ADD, rsp, imm(8) },
+		{ RET },
+	}, 5, &len);
+	if(!fn) return printf("direct call: %s\n", x64error(NULL)), 1;
+	if(fn() != 42) failed ++, puts("direct call: doesn't return 42");
+	if(len != 4 + 5 + 5 + 4 + 1) printf("direct call: %u bytes, the code must be too far away to call the function directly\n", len);
+	x64exec_free((void*) fn, len);
+
+	// The aligns could take 128 KB, so it takes a mapping of its own, but they don't pad at all and the mapping gets trimmed down
+	// to 1 page. Freeing it has to unmap it even though its 6 bytes look like they were cut out of a region.
+	fn = (int64_t (*)()) x64as_exec((x64) { { MOV, eax, imm(5) }, align_max(65536, 0), align_max(65536, 0), { RET } }, 4, &len);
+	if(!fn || len != 6) return printf("trimmed code: %s\n", fn ? "isn't 6 bytes" : x64error(NULL)), 1;
+	if(fn() != 5) failed ++, puts("trimmed code: doesn't return 5");
+	x64exec_free((void*) fn, len);
+	if(mapped((void*) fn)) failed ++, puts("trimmed code: is still mapped after it's freed");
+
+	// Code reused from the free lists after that is still sound.
+	fn = (int64_t (*)()) x64as_exec((x64) { { MOV, eax, imm(3) }, { RET } }, 2, &len);
+	if(!fn || fn() != 3) failed ++, puts("small code: doesn't return 3");
+	x64exec_free((void*) fn, len);
+
+	if(!failed) puts("All x64as_exec tests passed.");
+	return failed != 0;
+}
@@ -0,0 +1,46 @@
+#include <stdio.h>
+#include "../asm_x64.h"
+
+int main() {
+	int failed = 0;
+	uint32_t len;
+
+	// Code that only differs in its label IDs is the same code.
+	enum { A = 3, B = 7 };
+	int64_t (*a)(int64_t) = (int64_t (*)(int64_t)) x64cache((x64) {
+		{ MOV, rax, rdi }, { TEST, rdi, rdi }, { JNZ, lb(A) }, { MOV, eax, imm(-1) }, lb_def(A), { RET },
+	}, 6, &len);
+	int64_t (*b)(int64_t) = (int64_t (*)(int64_t)) x64cache((x64) {
+		{ MOV, rax, rdi }, { TEST, rdi, rdi }, { JNZ, lb(B) }, { MOV, eax, imm(-1) }, lb_def(B), { RET },
+	}, 6, &len);
+	if(!a || a != b) failed ++, puts("label ids: the same code with other label ids isn't shared");
+	else if(a(5) != 5 || a(0) != 0xffffffff) failed ++, puts("label ids: the shared code doesn't run right");
+
+	// Anything else isn't.
+	int64_t (*c)(int64_t) = (int64_t (*)(int64_t)) x64cache((x64) {
+		{ MOV, rax, rdi }, { TEST, rdi, rdi }, { JZ, lb(B) }, { MOV, eax, imm(-1) }, lb_def(B), { RET },
+	}, 6, &len);
+	if(!c || c == a || c(5) != 0xffffffff) failed ++, puts("different code: is shared");
+	x64cache_release(a);
+	x64cache_release(b);
+	x64cache_release(c);
+
+	// Code with patch points gets its own copy every time, and x64patch_site() is for the last one.
+	x64 patched = { patch_point(0), { MOV, eax, im32(1) }, { RET } };
+	int64_t (*p)() = (int64_t (*)()) x64cache(patched, 3, &len), (*q)() = (int64_t (*)()) x64cache(patched, 3, &len);
+	if(!p || !q || p == q) failed ++, puts("patch points: code with patch points is shared");
+	else {
+		x64patch_imm((uint8_t*) q + x64patch_site(0), 2, 4);
+		if(p() != 1 || q() != 2) failed ++, puts("patch points: patching 1 copy changed the other");
+	}
+	x64cache_release(p);
+	x64cache_release(q);
+	x64cache_flush();
+
+	x64ErrorType error;
+	if(x64cache((x64) { { JMP, lb(X64_MAX_LABEL + 1) }, lb_def(X64_MAX_LABEL + 1) }, 2, &len) || (x64error(&error), error != ASMERR_INVALID_LABEL))
+		failed ++, puts("label past X64_MAX_LABEL: wasn't rejected");
+
+	if(!failed) puts("All cache tests passed.");
+	return failed != 0;
+}
@@ -0,0 +1,63 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../asm_x64.h"
+
+// Finds the mapping `p` is in, in /proc/self/maps, and gets its permissions and inode. Returns 0 if there isn't one.
+static int mapping(const void* p, char perms[5], unsigned long* inode) {
+	FILE* f = fopen("/proc/self/maps", "r");
+	if(!f) return 0;
+	char line[512];
+	unsigned long start, end;
+	while(fgets(line, sizeof(line), f))
+		if(sscanf(line, "%lx-%lx %4s %*x %*s %lu", &start, &end, perms, inode) == 4 && (unsigned long) p >= start && (unsigned long) p < end)
+			return fclose(f), 1;
+	return fclose(f), 0;
+}
+
+// Whether there's a writable mapping of the memfd with `inode`.
+static int writable_view(unsigned long inode) {
+	FILE* f = fopen("/proc/self/maps", "r");
+	char line[512], perms[5];
+	unsigned long other;
+	int found = 0;
+	while(!found && fgets(line, sizeof(line), f))
+		found = sscanf(line, "%*x-%*x %4s %*x %*s %lu", perms, &other) == 2 && other == inode && perms[1] == 'w' && strstr(line, "memfd:");
+	return fclose(f), found;
+}
+
+int main() {
+#ifndef __linux__
+	puts("Only Linux maps code twice, skipped.");
+	return 0;
+#endif
+	int failed = 0;
+	x64 code = { patch_point(0), { MOV, eax, im32(1) }, { RET } };
+	uint32_t len;
+	uint8_t* assembled = x64as(code, 3, &len);
+	if(!assembled) return printf("dual mapping: %s\n", x64error(NULL)), 1;
+	const uint32_t site = x64patch_site(0);
+
+	uint8_t* exec = (uint8_t*) x64exec(assembled, len);
+	int64_t (*fn)() = (int64_t (*)()) exec;
+	free(assembled);
+
+	// The code is never writable where it runs, only through the other mapping of the same memory, if it got one.
+	char perms[5];
+	unsigned long inode;
+	if(!mapping(exec, perms, &inode)) return puts("dual mapping: the code isn't in /proc/self/maps"), 1;
+	if(perms[1] == 'w' || perms[2] != 'x') failed ++, printf("dual mapping: the code is mapped %s\n", perms);
+	if(perms[3] == 's' && !writable_view(inode)) failed ++, puts("dual mapping: the memfd isn't mapped writable anywhere");
+	if(perms[3] != 's') puts("The code is in 1 mapping, memfd_create() must not be allowed here.");
+
+	// Patches go through the writable mapping and show up where the code runs.
+	x64patch_imm(exec + site, 42, 4);
+	int32_t patched;
+	memcpy(&patched, exec + site, 4);
+	if(patched != 42 || fn() != 42) failed ++, puts("dual mapping: the patch doesn't show up in the code");
+	if(!mapping(exec, perms, &inode) || perms[1] == 'w') failed ++, printf("dual mapping: the code is mapped %s after patching it\n", perms);
+
+	x64exec_free(exec, len);
+	if(!failed) puts("All dual mapping tests passed.");
+	return failed != 0;
+}
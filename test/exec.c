@@ -0,0 +1,52 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "../asm_x64.h"
+
+// `mov eax, value` and `ret`, then INT3s up to `size` bytes.
+static void (*make(uint8_t* buf, uint32_t size, int32_t value))() {
+	memset(buf, 0xcc, size);
+	buf[0] = 0xb8;
+	memcpy(buf + 1, &value, 4);
+	buf[5] = 0xc3;
+	return x64exec(buf, size);
+}
+
+int main() {
+	int failed = 0;
+	static uint8_t buf[16384];
+
+	// Lots of small code, all of it 16 byte aligned and still there after the rest was loaded.
+	int64_t (*fns[200])();
+	for(int i = 0; i < 200; i ++) {
+		fns[i] = (int64_t (*)()) make(buf, 6 + i % 70, i);
+		if(!fns[i] || (uintptr_t) fns[i] % 16) return printf("small code: %p for %d isn't 16 byte aligned\n", (void*) fns[i], i), 1;
+	}
+	for(int i = 0; i < 200; i ++)
+		if(fns[i]() != i) failed ++, printf("small code: %d returned something else\n", i);
+
+	// Freed code is reused by the next of the same size.
+	void* freed = (void*) fns[50];
+	x64exec_free(freed, 6 + 50 % 70);
+	fns[50] = (int64_t (*)()) make(buf, 6 + 50 % 70, 1000);
+	if((void*) fns[50] != freed) failed ++, puts("free: the freed code wasn't reused");
+	if(fns[50]() != 1000) failed ++, puts("free: the reused code doesn't run");
+	for(int i = 0; i < 200; i ++) x64exec_free((void*) fns[i], 6 + i % 70);
+
+	// Code past 4 KB gets its own pages.
+	int64_t (*big)() = (int64_t (*)()) make(buf, sizeof(buf), 7);
+	if(!big || big() != 7) failed ++, puts("big code: doesn't return 7");
+	x64exec_free((void*) big, sizeof(buf));
+
+	// Code loaded in a batch runs in the batch and after it.
+	x64exec_begin();
+	int64_t (*a)() = (int64_t (*)()) make(buf, 32, 1), (*b)() = (int64_t (*)()) make(buf, 32, 2);
+	if(a() + b() != 3) failed ++, puts("batch: doesn't run in the batch");
+	x64exec_end();
+	if(a() + b() != 3) failed ++, puts("batch: doesn't run after the batch");
+	x64exec_free((void*) a, 32);
+	x64exec_free((void*) b, 32);
+
+	if(!failed) puts("All executable memory tests passed.");
+	return failed != 0;
+}
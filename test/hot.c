@@ -0,0 +1,32 @@
+#include <stdio.h>
+#include "../asm_x64.h"
+
+int main() {
+	int failed = 0;
+	uint8_t code[] = { 0xb8, 7, 0, 0, 0, 0xc3 }; // mov eax, 7; ret
+
+	// Hot code runs wherever it ended up, huge pages or not.
+	int64_t (*hot)() = (int64_t (*)()) x64exec_hot(code, sizeof(code));
+	if(!hot || hot() != 7) return puts("hot code: doesn't return 7"), 1;
+
+	// Freed hot code is only reused by hot code, so code from x64exec() never ends up between it.
+	x64exec_free((void*) hot, sizeof(code));
+	void (*cold[100])();
+	for(int i = 0; i < 100; i ++)
+		if((cold[i] = x64exec(code, sizeof(code))) == (void (*)()) hot) failed ++, puts("x64exec(): reused freed hot code");
+	int64_t (*again)() = (int64_t (*)()) x64exec_hot(code, sizeof(code));
+	if(again != hot) failed ++, puts("x64exec_hot(): didn't reuse freed hot code");
+
+	// And freed code from x64exec() isn't reused by hot code.
+	x64exec_free((void*) cold[0], sizeof(code));
+	int64_t (*other)() = (int64_t (*)()) x64exec_hot(code, sizeof(code));
+	if(other == (int64_t (*)()) cold[0]) failed ++, puts("x64exec_hot(): reused freed code from x64exec()");
+	if(again() + other() != 14) failed ++, puts("hot code: doesn't run after being reused");
+
+	for(int i = 1; i < 100; i ++) x64exec_free((void*) cold[i], sizeof(code));
+	x64exec_free((void*) again, sizeof(code));
+	x64exec_free((void*) other, sizeof(code));
+
+	if(!failed) puts("All hot code tests passed.");
+	return failed != 0;
+}
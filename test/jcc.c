@@ -0,0 +1,63 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../asm_x64.h"
+
+// Assembles and runs `code`, which has to return 5, be `length` bytes and have `at` where `start` should start.
+static int check(const char* name, x64 code, uint32_t num, uint32_t length, uint32_t start, uint8_t at) {
+	uint32_t len;
+	uint8_t* assembled = x64as(code, num, &len);
+	if(!assembled) return printf("%s: %s\n", name, x64error(NULL)), 1;
+	if(len != length || assembled[start] != at)
+		return printf("%s: %u bytes with %02x at %u, instead of %u with %02x\n", name, len, assembled[start], start, length, at), free(assembled), 1;
+
+	int64_t (*fn)() = (int64_t (*)()) x64exec(assembled, len);
+	int64_t got = fn();
+	x64exec_free(fn, len);
+	free(assembled);
+	if(got != 5) return printf("%s: returned %lld instead of 5\n", name, (long long) got), 1;
+	return 0;
+}
+
+int main() {
+	int failed = 0;
+
+	// The TEST and JZ after it would be bytes 30 to 33, across the boundary at 32, so the 2 of them get moved onto it.
+	x64as_mode(X64_MODE_JCC_ERRATUM);
+	failed += check("fused jump", (x64) {
+		{ MOV, eax, imm(5) },
+		{ MOV, rcx, imm(0x1122334455667788) },
+		{ MOV, rdx, imm(0x1122334455667788) },
+		{ MOV, esi, imm(1) },
+		{ TEST, eax, eax },
+		{ JZ, rel(2) },
+		{ RET },
+		{ INT3 },
+	}, 8, 32 + 2 + 2 + 1 + 1, 32, 0x85);
+
+	// A JMP ending on the boundary gets moved past it.
+	failed += check("jump ending on a boundary", (x64) {
+		{ MOV, eax, imm(5) },
+		{ MOV, rcx, imm(0x1122334455667788) },
+		{ MOV, rdx, imm(0x1122334455667788) },
+		{ MOV, esi, imm(1) },
+		{ JMP, rel(2) },
+		{ INT3 },
+		{ RET },
+	}, 7, 32 + 2 + 1 + 1, 32, 0xeb);
+
+	// Nothing's padded without the mode.
+	x64as_mode(0);
+	failed += check("without the mode", (x64) {
+		{ MOV, eax, imm(5) },
+		{ MOV, rcx, imm(0x1122334455667788) },
+		{ MOV, rdx, imm(0x1122334455667788) },
+		{ MOV, esi, imm(1) },
+		{ TEST, eax, eax },
+		{ JZ, rel(2) },
+		{ RET },
+		{ INT3 },
+	}, 8, 30 + 2 + 2 + 1 + 1, 30, 0x85);
+
+	if(!failed) puts("All JCC erratum tests passed.");
+	return failed != 0;
+}
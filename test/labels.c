@@ -0,0 +1,57 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../asm_x64.h"
+
+// Assembles `code`, which has to either fail with `error`, or run with `arg` in rdi and return `expected`.
+static int check(const char* name, x64 code, uint32_t num, int64_t arg, int64_t expected, x64ErrorType error) {
+	uint32_t len;
+	uint8_t* assembled = x64as(code, num, &len);
+	if(error) {
+		if(assembled) return printf("%s: assembled instead of failing\n", name), free(assembled), 1;
+		x64ErrorType got;
+		char* msg = x64error(&got);
+		if(got != error) return printf("%s: failed with '%s' instead\n", name, msg), 1;
+		return 0;
+	}
+	if(!assembled) return printf("%s: %s\n", name, x64error(NULL)), 1;
+
+	int64_t (*fn)(int64_t) = (int64_t (*)(int64_t)) x64exec(assembled, len);
+	int64_t got = fn(arg);
+	x64exec_free(fn, len);
+	free(assembled);
+	if(got != expected) return printf("%s: returned %lld instead of %lld\n", name, (long long) got, (long long) expected), 1;
+	return 0;
+}
+
+int main() {
+	int failed = 0;
+	enum { LOOP, DONE };
+
+	// Sums rdi down to 1, jumping both forwards and backwards to labels.
+	failed += check("loop", (x64) {
+		{ MOV, rax, imm(0) },
+		lb_def(LOOP),
+		{ TEST, rdi, rdi },
+		{ JZ, lb(DONE) },
+		{ ADD, rax, rdi },
+		{ DEC, rdi },
+		{ JMP, lb(LOOP) },
+		lb_def(DONE),
+		{ RET },
+	}, 9, 10, 55, 0);
+
+	failed += check("undefined label", (x64) { { JMP, lb(DONE) }, { RET } }, 2, 0, 0, ASMERR_INVALID_LABEL);
+	failed += check("label defined twice", (x64) { lb_def(LOOP), lb_def(LOOP), { JMP, lb(LOOP) } }, 3, 0, 0, ASMERR_INVALID_LABEL);
+	failed += check("label past X64_MAX_LABEL", (x64) { lb_def(X64_MAX_LABEL + 1), { RET } }, 2, 0, 0, ASMERR_INVALID_LABEL);
+
+	// Streams can't know where a label is, so they don't take them.
+	x64Stream* s = x64stream();
+	x64ErrorType error;
+	uint32_t len;
+	if(x64stream_push(s, (x64) { { MOV, eax, imm(1) }, { JMP, lb(DONE) } }, 2) != 1 || (x64error(&error), error != ASMERR_INVALID_LABEL))
+		failed ++, puts("label in a stream: wasn't rejected");
+	free(x64stream_finish(s, &len));
+
+	if(!failed) puts("All label tests passed.");
+	return failed != 0;
+}
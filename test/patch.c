@@ -0,0 +1,47 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../asm_x64.h"
+
+int main() {
+	int failed = 0;
+
+	uint32_t len;
+	uint8_t* code = x64as((x64) {
+		patch_point(0),
+		{ MOV, eax, im32(7) },
+		patch_point(1),
+		{ JMP, rel(2) },
+		{ INT3 },
+		{ RET },
+		patch_point(2),
+		{ MOV, eax, im32(9) },
+		{ RET },
+	}, 9, &len);
+	if(!code) return printf("patch points: %s\n", x64error(NULL)), 1;
+
+	// Every site has to be inside of an aligned 8 byte word to be patched with 1 store.
+	const uint32_t sites[] = { x64patch_site(0), x64patch_site(1), x64patch_site(2) };
+	for(int i = 0; i < 3; i ++)
+		if(sites[i] >= len || sites[i] % 8 > 4) failed ++, printf("patch point %d: its site %u isn't in an aligned word\n", i, sites[i]);
+	if(failed) return 1;
+
+	uint8_t* exec = (uint8_t*) x64exec(code, len);
+	int64_t (*fn)() = (int64_t (*)()) exec;
+	if(fn() != 7) failed ++, puts("patch points: doesn't return 7 before it's patched");
+
+	x64patch_imm(exec + sites[0], 8, 4);
+	if(fn() != 8) failed ++, puts("x64patch_imm: doesn't return the new immediate");
+
+	// Jumps to the MOV of patch point 2, which is the byte before its immediate.
+	x64patch_rel(exec + sites[1], exec + sites[2] - 1);
+	x64patch_imm(exec + sites[2], 11, 4);
+	if(fn() != 11) failed ++, puts("x64patch_rel: doesn't jump to the new target");
+
+	x64exec_free(exec, len);
+	free(code);
+
+	if(x64as((x64) { patch_point(X64_MAX_LABEL + 1), { MOV, eax, im32(1) } }, 2, &len)) failed ++, puts("patch point past X64_MAX_LABEL: assembled");
+
+	if(!failed) puts("All patch point tests passed.");
+	return failed != 0;
+}
@@ -0,0 +1,49 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../asm_x64.h"
+
+// Assembles and runs `code`, which has to return `expected` and start with `first`.
+static int check(const char* name, x64 code, uint32_t num, int64_t expected, uint8_t first, uint32_t length) {
+	uint32_t len;
+	uint8_t* assembled = x64as(code, num, &len);
+	if(!assembled) return printf("%s: %s\n", name, x64error(NULL)), 1;
+	if(assembled[0] != first || len != length)
+		return printf("%s: starts with %02x and is %u bytes instead of %02x and %u\n", name, assembled[0], len, first, length), free(assembled), 1;
+
+	int64_t (*fn)() = (int64_t (*)()) x64exec(assembled, len);
+	int64_t got = fn();
+	x64exec_free(fn, len);
+	free(assembled);
+	if(got != expected) return printf("%s: returned %lld instead of %lld\n", name, (long long) got, (long long) expected), 1;
+	return 0;
+}
+
+int main() {
+	int failed = 0;
+
+	// The first jump reaches with a rel8 only while the second one is a rel8 too, which it can't be, so both have to widen.
+	failed += check("widened by a neighbour", (x64) {
+		{ JMP, rel(15) },
+		{ JMP, rel(16) },
+		{ MOV, rcx, imm(0x1122334455667788) }, { MOV, rcx, imm(0x1122334455667788) }, { MOV, rcx, imm(0x1122334455667788) },
+		{ MOV, rcx, imm(0x1122334455667788) }, { MOV, rcx, imm(0x1122334455667788) }, { MOV, rcx, imm(0x1122334455667788) },
+		{ MOV, rcx, imm(0x1122334455667788) }, { MOV, rcx, imm(0x1122334455667788) }, { MOV, rcx, imm(0x1122334455667788) },
+		{ MOV, rcx, imm(0x1122334455667788) }, { MOV, rcx, imm(0x1122334455667788) }, { MOV, rcx, imm(0x1122334455667788) },
+		{ MOV, eax, imm(5) },
+		{ MOV, eax, imm(7) },
+		{ RET },
+		{ MOV, eax, imm(9) },
+		{ RET },
+	}, 19, 7, 0xe9, 5 + 5 + 12 * 10 + 5 + 5 + 1 + 5 + 1);
+
+	// Jumps that reach stay short.
+	failed += check("short jump", (x64) {
+		{ JMP, rel(2) },
+		{ INT3 },
+		{ MOV, eax, imm(3) },
+		{ RET },
+	}, 4, 3, 0xeb, 2 + 1 + 5 + 1);
+
+	if(!failed) puts("All relaxation tests passed.");
+	return failed != 0;
+}
@@ -0,0 +1,55 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../asm_x64.h"
+
+static int64_t twice(int64_t x) { return x * 2; }
+
+// Assembles and runs `code`, which has to be `length` bytes with its veneers and return `expected`.
+static int check(const char* name, x64 code, uint32_t num, uint32_t length, int64_t expected) {
+	uint32_t len;
+	uint8_t* assembled = x64as(code, num, &len);
+	if(!assembled) return printf("%s: %s\n", name, x64error(NULL)), 1;
+	if(len != length) return printf("%s: %u bytes instead of %u\n", name, len, length), free(assembled), 1;
+
+	int64_t (*fn)() = (int64_t (*)()) x64exec(assembled, len);
+	int64_t got = fn();
+	x64exec_free(fn, len);
+	free(assembled);
+	if(got != expected) return printf("%s: returned %lld instead of %lld\n", name, (long long) got, (long long) expected), 1;
+	return 0;
+}
+
+int main() {
+	int failed = 0;
+
+	// x64as() doesn't know where the code goes, so the call goes through a 14 byte veneer after the code.
+	failed += check("call through a veneer", (x64) {
+		{ SUB, rsp, imm(8) },
+		{ MOV, edi, imm(21) },
+		{ CALL, relptr(twice) },
+		{ ADD, rsp, imm(8) },
+		{ RET },
+	}, 5, 4 + 5 + 5 + 4 + 1 + 14, 42);
+
+	// Both calls to the same function share a veneer, and tail calls work the same.
+	failed += check("shared veneer", (x64) {
+		{ SUB, rsp, imm(8) },
+		{ MOV, edi, imm(5) },
+		{ CALL, relptr(twice) },
+		{ ADD, rsp, imm(8) },
+		{ MOV, rdi, rax },
+		{ JMP, relptr(twice) },
+	}, 6, 4 + 5 + 5 + 4 + 3 + 5 + 14, 20);
+
+	// Code that's going to run near the function calls it directly.
+	uint8_t buf[64];
+	const uint64_t base = (uint64_t) (void*) twice + 0x1000;
+	uint32_t len = x64as_at((x64) { { CALL, relptr(twice) }, { RET } }, 2, buf, sizeof(buf), base);
+	int32_t rel = 0;
+	memcpy(&rel, buf + 1, 4);
+	if(len != 5 + 1 || buf[0] != 0xe8 || (uint64_t) (void*) twice != base + 5 + rel) failed ++, puts("direct call: isn't a call straight to the function");
+
+	if(!failed) puts("All relptr tests passed.");
+	return failed != 0;
+}
@@ -0,0 +1,39 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../asm_x64.h"
+
+int main() {
+	int failed = 0;
+	enum { FAIL, OUT };
+
+	// The cold path in the middle of the code ends up after all of the hot code, and jumps there and back.
+	uint32_t len;
+	uint8_t* code = x64as((x64) {
+		{ TEST, rdi, rdi },
+		{ JZ, lb(FAIL) },
+		{ MOV, eax, imm(1) },
+		{ RET },
+		sect(X64_COLD),
+		lb_def(FAIL),
+		{ MOV, eax, imm(-1) },
+		{ JMP, lb(OUT) },
+		sect(X64_HOT),
+		lb_def(OUT),
+		{ ADD, eax, imm(10) },
+		{ RET },
+	}, 12, &len);
+	if(!code) return printf("cold path: %s\n", x64error(NULL)), 1;
+
+	// TEST, JZ, MOV, RET, ADD and RET, then the cold MOV and JMP.
+	const uint32_t hot = 3 + 2 + 5 + 1 + 3 + 1;
+	if(len != hot + 5 + 2 || code[hot] != 0xb8) failed ++, printf("cold path: %u bytes, with %02x where the cold code should start\n", len, code[hot]);
+
+	int64_t (*fn)(int64_t) = (int64_t (*)(int64_t)) x64exec(code, len);
+	if(fn(1) != 1) failed ++, puts("cold path: the hot path doesn't return 1");
+	if(fn(0) != 9) failed ++, puts("cold path: the cold path doesn't return 9");
+	x64exec_free(fn, len);
+	free(code);
+
+	if(!failed) puts("All section tests passed.");
+	return failed != 0;
+}
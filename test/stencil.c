@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../asm_x64.h"
+
+static int64_t data[] = { 1, 2, 3, 4 };
+
+// Builds a stencil from `code`, fills its holes with `values` and runs it with `data` in rdi. Every hole has to still hold its
+// value where x64stencil() says it is, and the code has to return `expected`.
+static int check(const char* name, x64 code, uint32_t num, const int64_t* values, int64_t expected) {
+	x64Stencil* stencil = x64stencil(code, num);
+	if(!stencil) return printf("%s: %s\n", name, x64error(NULL)), 1;
+
+	uint8_t buf[256];
+	uint32_t len = x64stencil_emit(stencil, values, buf);
+	for(uint32_t i = 0; i < stencil->numholes; i ++) {
+		const struct x64StencilHole* h = stencil->holes + i;
+		int64_t value = 0;
+		memcpy(&value, buf + h->offset, h->width);
+		if(!h->rel && value != values[i]) return printf("%s: hole %u is at the wrong offset %u\n", name, i, h->offset), free(stencil), 1;
+	}
+	free(stencil);
+
+	int64_t (*fn)(int64_t*) = (int64_t (*)(int64_t*)) x64exec(buf, len);
+	int64_t got = fn(data);
+	x64exec_free(fn, len);
+	if(got != expected) return printf("%s: returned %lld instead of %lld\n", name, (long long) got, (long long) expected), 1;
+	return 0;
+}
+
+int main() {
+	int failed = 0;
+
+	// imm() holes take the widest immediate the instruction has, so values past an imm8 or imm32 still fit.
+	failed += check("imm32 hole", (x64) {
+		{ MOV, rax, imm(5) },
+		{ ADD, rax, hole(imm(0)) },
+		{ RET },
+	}, 3, (int64_t[]) { 1000 }, 1005);
+	failed += check("imm64 hole", (x64) {
+		{ MOV, rax, hole(imm(0)) },
+		{ RET },
+	}, 2, (int64_t[]) { 0x123456789abcdef }, 0x123456789abcdef);
+	failed += check("imm8 only hole", (x64) {
+		{ MOV, rax, imm(3) },
+		{ SHL, rax, hole(imm(0)) },
+		{ RET },
+	}, 3, (int64_t[]) { 4 }, 48);
+
+	// Displacements always get a disp32.
+	failed += check("displacement hole", (x64) {
+		{ MOV, rax, hole(m64($rdi, 0)) },
+		{ RET },
+	}, 2, (int64_t[]) { 16 }, 3);
+
+	// The instruction after a hole is in another section, somewhere else entirely.
+	failed += check("section after a hole", (x64) {
+		{ MOV, eax, hole(imm(0)) },
+		sect(X64_COLD),
+		{ INT3 },
+		sect(X64_HOT),
+		{ RET },
+	}, 5, (int64_t[]) { 42 }, 42);
+
+	// The hole ends 2 bytes before a 32 byte boundary, so the TEST and JZ fused after it get padded onto the boundary.
+	x64as_mode(X64_MODE_JCC_ERRATUM);
+	failed += check("padded jump after a hole", (x64) {
+		{ MOV, rcx, imm(0x1122334455667788) },
+		{ MOV, rdx, imm(0x1122334455667788) },
+		{ MOV, esi, imm(1) },
+		{ MOV, eax, hole(imm(0)) },
+		{ TEST, eax, eax },
+		{ JZ, rel(2) },
+		{ RET },
+		{ INT3 },
+	}, 8, (int64_t[]) { 42 }, 42);
+	x64as_mode(0);
+
+	// The pool goes after all of the code, so the instruction before a constant doesn't end where the constant starts.
+	failed += check("pool after a hole", (x64) {
+		{ MOV, rax, m64($riprel, 2) },
+		{ ADD, rax, hole(imm(0)) },
+		pool64(5),
+		{ RET },
+	}, 4, (int64_t[]) { 10 }, 15);
+
+	x64Stencil* empty = x64stencil((x64) { { RET } }, 0);
+	if(!empty || empty->len || empty->numholes) failed ++, puts("empty stencil: isn't empty");
+	free(empty);
+
+	if(!failed) puts("All stencil tests passed.");
+	return failed != 0;
+}
@@ -0,0 +1,47 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../asm_x64.h"
+
+// Finishes the stream and runs its code, which has to return `expected`. Returns the code's length, or 0 if it failed.
+static uint32_t run(const char* name, x64Stream* s, int64_t expected, uint8_t* first) {
+	uint32_t len;
+	uint8_t* code = x64stream_finish(s, &len);
+	if(!code) return printf("%s: %s\n", name, x64error(NULL)), 0;
+	*first = code[0];
+
+	int64_t (*fn)() = (int64_t (*)()) x64exec(code, len);
+	int64_t got = fn();
+	x64exec_free(fn, len);
+	free(code);
+	if(got != expected) return printf("%s: returned %lld instead of %lld\n", name, (long long) got, (long long) expected), 0;
+	return len;
+}
+
+int main() {
+	int failed = 0;
+	uint8_t first;
+
+	// A forward jump over 200 bytes pushed in 3 chunks, which a rel8 can't reach.
+	x64Stream* s = x64stream();
+	x64stream_push(s, (x64) { { JMP, rel(21) }, { MOV, eax, imm(1) } }, 2);
+	for(int i = 0; i < 19; i ++) x64stream_push(s, (x64) { { MOV, rcx, imm(0x1122334455667788) } }, 1);
+	x64stream_push(s, (x64) { { MOV, eax, imm(2) }, { RET } }, 2);
+	if(!run("far forward jump", s, 2, &first)) failed ++;
+
+	// Forward jumps are a rel32 even when they're short, since how far they go isn't known when they're pushed.
+	s = x64stream();
+	x64stream_push(s, (x64) { { JMP, rel(2) }, { INT3 }, { MOV, eax, imm(3) }, { RET } }, 4);
+	if(!run("near forward jump", s, 3, &first)) failed ++;
+	else if(first != 0xe9) failed ++, printf("near forward jump: starts with %02x instead of a jmp rel32\n", first);
+
+	// Backward ones are as short as they can be.
+	s = x64stream();
+	x64stream_push(s, (x64) { { XOR, eax, eax }, { MOV, ecx, imm(10) } }, 2);
+	x64stream_push(s, (x64) { { ADD, eax, imm(3) }, { DEC, ecx }, { JNZ, rel(-2) }, { RET } }, 4);
+	uint32_t len = run("backward jump", s, 30, &first);
+	if(!len) failed ++;
+	else if(len != 2 + 5 + 3 + 2 + 2 + 1) failed ++, printf("backward jump: %u bytes instead of a jnz rel8\n", len);
+
+	if(!failed) puts("All stream tests passed.");
+	return failed != 0;
+}
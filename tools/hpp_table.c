@@ -0,0 +1,61 @@
+#include "../asm_x64.c"
+
+// Prints the forms[] and op_forms[] tables of asm_x64.hpp from x64Table, or with `--check asm_x64.hpp`, checks that the ones in
+// it are still the same, so the 2 tables can't drift apart. Run it after changing x64Table:
+//
+//   cc -O1 -o hpp_table tools/hpp_table.c && ./hpp_table --check asm_x64.hpp
+
+static char* out;
+static u32 outlen, outcap;
+
+static void put(const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  const int len = vsnprintf(NULL, 0, fmt, args);
+  va_end(args);
+  if(outlen + len + 1 > outcap && !(out = realloc(out, outcap = (outlen + len + 1) * 2))) exit(1);
+  va_start(args, fmt);
+  vsnprintf(out + outlen, len + 1, fmt, args);
+  va_end(args);
+  outlen += len;
+}
+
+static void tables(void) {
+  const u32 ops = sizeof(x64Table) / sizeof(*x64Table);
+  put("inline constexpr x64Form forms[] = {\n");
+  for(u32 i = 0; i < ops; i ++)
+    for(u32 f = 0; f < x64Table[i].numactualins; f ++) {
+      const x64LookupActualIns* r = x64Table[i].ins + f;
+      put("\t{ %u, %u, %u, %u, %u, %u, 0x%x, %u, %u, 0x%x, 0x%x, 0x%x, %d, %d, %d, %u, 0x%x, 0x%x, { ",
+          r->mem_oper, r->reg_oper, r->rel_oper, r->vex_oper, r->imm_oper, r->is4_oper, r->rex, r->oplen, r->preflen, r->vex,
+          r->vex_byte, r->modrm, r->modrmreq, r->modrmreg, r->preffered, r->arglen, r->opcode, r->prefixes);
+      for(u32 j = 0; j < r->arglen; j ++) put("%s0x%llx", j ? ", " : "", (unsigned long long) r->args[j]);
+      put(" } },%s%s\n", f ? "" : " // ", f ? "" : x64Table[i].name);
+    }
+
+  put("};\n\n// Index of each op's first form in `forms`, so op `i`'s forms are `forms[op_forms[i - 1]]` up to `forms[op_forms[i]]`.\n"
+      "inline constexpr uint16_t op_forms[] = {");
+  for(u32 i = 0, first = 0; i <= ops; i ++) {
+    put(i % 16 ? " %u," : "\n\t%u,", first);
+    if(i < ops) first += x64Table[i].numactualins;
+  }
+  put("\n};\n");
+}
+
+int main(int argc, char** argv) {
+  tables();
+  if(argc < 3 || strcmp(argv[1], "--check")) return fputs(out, stdout), 0;
+
+  FILE* f = fopen(argv[2], "rb");
+  if(!f) return fprintf(stderr, "Can't open %s.\n", argv[2]), 1;
+  fseek(f, 0, SEEK_END);
+  const long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  char* hpp = malloc(size + 1);
+  hpp[fread(hpp, 1, size, f)] = 0;
+  fclose(f);
+
+  if(!strstr(hpp, out)) return fprintf(stderr, "The tables in %s don't match x64Table, regenerate them.\n", argv[2]), 1;
+  puts("The tables match.");
+  return 0;
+}